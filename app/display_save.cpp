@@ -17,6 +17,13 @@ int main(int argc, char** argv)
     logger.Info() << "Location: " << std::hex << gameData.mLocation.mLocation << std::dec << "\n";
     logger.Info() << "Location: " << gameData.mLocation.mLocation << "\n";
 
+    gameData.LoadShops();
+    gameData.LoadCombatEntityLists();
+    gameData.LoadCombatStats(
+        BAK::GameData::sCombatSkillsListOffset,
+        BAK::GameData::sCombatSkillsListCount);
+    gameData.LoadCombatGridLocations();
+    gameData.LoadCombatWorldLocations();
     gameData.LoadCombatInventories();
     return 0;
 }
@@ -3,16 +3,20 @@
 #include "bak/container.hpp"
 #include "bak/coordinates.hpp"
 #include "bak/gameData.hpp"
+#include "bak/saveWriter.hpp"
 #include "bak/screens.hpp"
 
 extern "C" {
 #include "com/getopt.h"
 }
 
+#include "com/allocationTracker.hpp"
 #include "com/logger.hpp"
 #include "com/path.hpp"
+#include "com/random.hpp"
 #include "com/visit.hpp"
 
+#include "game/benchmark.hpp"
 #include "game/console.hpp"
 #include "game/gameRunner.hpp"
 #include "game/systems.hpp"
@@ -21,6 +25,9 @@ extern "C" {
 #include "graphics/guiRenderer.hpp"
 #include "graphics/glfw.hpp"
 #include "graphics/framebuffer.hpp"
+#include "graphics/frameScheduler.hpp"
+#include "graphics/inputRecording.hpp"
+#include "graphics/profiler.hpp"
 #include "graphics/renderer.hpp"
 #include "graphics/sprites.hpp"
 
@@ -33,7 +40,10 @@ extern "C" {
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <fstream>
 #include <functional>
 #include <memory>
 #include <sstream>
@@ -44,7 +54,7 @@ int main(int argc, char** argv)
 {
     const auto& logger = Logging::LogState::GetLogger("main");
 
-    const bool showImgui = true;
+    bool showImgui = true;
 
     auto log = std::ofstream{ std::filesystem::path{GetBakDirectory()} / "main3d.log" };
     Logging::LogState::AddStream(&log);
@@ -65,24 +75,81 @@ int main(int argc, char** argv)
     Logging::LogState::Disable("Gui::AnimatorStore");
 
     struct option options[] = {
-        {"help", no_argument,       0, 'h'},
-        {"save", required_argument, 0, 's'},
-        {"zone", required_argument, 0, 'z'}
+        {"help",      no_argument,       0, 'h'},
+        {"save",      required_argument, 0, 's'},
+        {"zone",      required_argument, 0, 'z'},
+        {"fps",       required_argument, 0, 'f'},
+        {"no-vsync",  no_argument,       0, 'v'},
+        {"on-demand", no_argument,       0, 'o'},
+        {"benchmark", required_argument, 0, 'b'},
+        {"seed",      required_argument, 0, 'r'},
+        {"record",    required_argument, 0, 'c'},
+        {"replay",    required_argument, 0, 'p'},
+        {"zero-alloc", required_argument, 0, 'a'},
+        {0, 0, 0, 0}
     };
     int optionIndex = 0;
     int opt;
 
     BAK::ZoneLabel zoneLabel{1};
     std::optional<std::string> saveName{};
+
+    // Vsync alone doesn't limit software GL, so cap the rate too
+    auto schedulerConfig = Graphics::FrameSchedulerConfig{
+        .mTargetFps = 60.0,
+        .mOnDemand = false,
+        .mIdleFps = 4.0};
+    bool vsync = true;
+    std::optional<std::filesystem::path> benchmarkReport{};
+    std::optional<std::uint64_t> seed{};
+    std::optional<std::filesystem::path> recordLog{};
+    std::optional<std::filesystem::path> replayLog{};
+    std::optional<unsigned> zeroAllocFrames{};
     
 	bool noOptions = true;
-    while ((opt = getopt_long(argc, argv, "hs:z:", options, &optionIndex)) != -1)
+    while ((opt = getopt_long(argc, argv, "hs:z:f:vob:r:c:p:a:", options, &optionIndex)) != -1)
     {   
         if (opt == 'h')
         {
-            std::cout << "Usage: " << argv[0] << " --save SAVE_FILE | --zone ZXX\n";
+            std::cout << "Usage: " << argv[0] << " --save SAVE_FILE | --zone ZXX"
+                << " [--fps FPS (0 for uncapped)] [--no-vsync] [--on-demand]"
+                << " [--benchmark REPORT_FILE] [--seed SEED]"
+                << " [--record INPUT_LOG | --replay INPUT_LOG]"
+                << " [--zero-alloc FRAMES]\n";
             exit(0);
         }
+        else if (opt == 'f')
+        {
+            schedulerConfig.mTargetFps = std::max(std::atof(optarg), 0.0);
+        }
+        else if (opt == 'v')
+        {
+            vsync = false;
+        }
+        else if (opt == 'o')
+        {
+            schedulerConfig.mOnDemand = true;
+        }
+        else if (opt == 'b')
+        {
+            benchmarkReport = optarg;
+        }
+        else if (opt == 'r')
+        {
+            seed = std::strtoull(optarg, nullptr, 0);
+        }
+        else if (opt == 'c')
+        {
+            recordLog = optarg;
+        }
+        else if (opt == 'p')
+        {
+            replayLog = optarg;
+        }
+        else if (opt == 'a')
+        {
+            zeroAllocFrames = std::strtoul(optarg, nullptr, 0);
+        }
         else if (opt == 's')
         {
 			noOptions = false;
@@ -104,6 +171,81 @@ int main(int argc, char** argv)
 		saveName = "NEW_GAME.GAM";
 	}
 
+    if (replayLog && (recordLog || benchmarkReport))
+    {
+        logger.Error() << "--replay can't be combined with --record or --benchmark\n";
+        return 1;
+    }
+
+    if (zeroAllocFrames && (replayLog || recordLog || benchmarkReport))
+    {
+        logger.Error() << "--zero-alloc can't be combined with --replay, --record or --benchmark\n";
+        return 1;
+    }
+
+    if (zeroAllocFrames && !Allocations::IsTracking())
+    {
+        logger.Error() << "--zero-alloc needs a build with BAK_TRACK_ALLOCATIONS\n";
+        return 1;
+    }
+
+    // Replays start from wherever the recording did
+    constexpr auto sStartSave = std::string_view{"save:"};
+    constexpr auto sStartZone = std::string_view{"zone:"};
+    std::unique_ptr<Graphics::InputReplay> replay{};
+    if (replayLog)
+    {
+        replay = std::make_unique<Graphics::InputReplay>(*replayLog);
+        seed = replay->GetSeed();
+        const auto& start = replay->GetStart();
+        if (start.starts_with(sStartSave))
+        {
+            saveName = start.substr(sStartSave.size());
+        }
+        else
+        {
+            ASSERT(start.starts_with(sStartZone));
+            saveName.reset();
+            zoneLabel = BAK::ZoneLabel{start.substr(sStartZone.size())};
+        }
+    }
+
+    // Benchmarks, replays and allocation checks run offscreen as fast
+    // as possible
+    if (benchmarkReport || replay || zeroAllocFrames)
+    {
+        showImgui = false;
+        vsync = false;
+        schedulerConfig.mTargetFps = 0;
+        schedulerConfig.mOnDemand = false;
+        if (!seed)
+            seed = 0;
+    }
+
+    // The debug UI acts on the game directly rather than through the
+    // input handler so it can't be replayed. Draw every frame so that
+    // picking sees the same frames as the replay.
+    if (recordLog)
+    {
+        showImgui = false;
+        schedulerConfig.mOnDemand = false;
+    }
+
+    if (seed)
+        SetRandomSeed(*seed);
+    logger.Info() << "Random seed: " << GetRandomSeed() << "\n";
+
+    std::unique_ptr<Graphics::InputRecorder> recorder{};
+    if (recordLog)
+    {
+        recorder = std::make_unique<Graphics::InputRecorder>(
+            *recordLog,
+            GetRandomSeed(),
+            saveName
+                ? std::string{sStartSave} + *saveName
+                : std::string{sStartZone} + zoneLabel.GetZoneLabel());
+    }
+
     auto guiScalar = 4.0f;
 
     auto nativeWidth = 320.0f;
@@ -118,7 +260,9 @@ int main(int argc, char** argv)
     auto window = Graphics::MakeGlfwWindow(
         height,
         width,
-        "BaK");
+        "BaK",
+        benchmarkReport.has_value() || replay != nullptr || zeroAllocFrames.has_value());
+    glfwSwapInterval(vsync ? 1 : 0);
 
     auto spriteManager = Graphics::SpriteManager{};
     auto guiRenderer = Graphics::GuiRenderer{
@@ -157,8 +301,6 @@ int main(int argc, char** argv)
         2.0f};
     Camera* cameraPtr = &camera;
 
-    guiManager.mMainView.SetHeading(camera.GetHeading());
-
     // OpenGL 3D Renderer
     constexpr auto sShadowDim = 4096;
     auto renderer = Graphics::Renderer{
@@ -177,6 +319,7 @@ int main(int argc, char** argv)
 
     // Wire up the zone loader to the GUI manager
     guiManager.SetZoneLoader(&gameRunner);
+    const auto loadStart = std::chrono::steady_clock::now();
     if (saveName)
     {
         gameRunner.LoadGame(*saveName);
@@ -190,6 +333,16 @@ int main(int argc, char** argv)
         camera.SetPosition(position);
     }
 
+    const auto loadTime = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - loadStart).count();
+
+    std::unique_ptr<Game::Benchmark> benchmark{};
+    if (benchmarkReport)
+    {
+        benchmark = std::make_unique<Game::Benchmark>(camera, guiManager, gameRunner);
+        benchmark->RecordLoad("initial", loadTime);
+    }
+
     auto currentTile = camera.GetGameTile();
     logger.Info() << " Starting on tile: " << currentTile << "\n";
 
@@ -222,6 +375,7 @@ int main(int argc, char** argv)
     };
 
     Graphics::InputHandler inputHandler{};
+    inputHandler.SetRecorder(recorder.get());
     inputHandler.Bind(GLFW_KEY_G,     [&]{ if (guiManager.InMainView()) cameraPtr = &camera; });
     inputHandler.Bind(GLFW_KEY_H,     [&]{ if (guiManager.InMainView()) cameraPtr = &lightCamera; });
     inputHandler.Bind(GLFW_KEY_R,     [&]{
@@ -241,13 +395,13 @@ int main(int argc, char** argv)
         if (guiManager.InMainView())
         {
             cameraPtr->RotateLeft();
-            guiManager.mMainView.SetHeading(cameraPtr->GetHeading());
+            gameState.SetLocation(cameraPtr->GetGameLocation());
         }});
     inputHandler.Bind(GLFW_KEY_E, [&]{ 
         if (guiManager.InMainView())
         {
             cameraPtr->RotateRight();
-            guiManager.mMainView.SetHeading(cameraPtr->GetHeading());
+            gameState.SetLocation(cameraPtr->GetGameLocation());
         }});
     inputHandler.Bind(GLFW_KEY_X, [&]{ if (guiManager.InMainView()) cameraPtr->RotateVerticalUp(); });
     inputHandler.Bind(GLFW_KEY_Y, [&]{ if (guiManager.InMainView()) cameraPtr->RotateVerticalDown(); });
@@ -256,8 +410,13 @@ int main(int argc, char** argv)
     inputHandler.Bind(GLFW_KEY_BACKSPACE,   [&]{ if (root.OnKeyEvent(Gui::KeyPress{GLFW_KEY_BACKSPACE})){ ;} });
     inputHandler.BindCharacter([&](char character){ if(root.OnKeyEvent(Gui::Character{character})){ ;} });
 
-    Graphics::InputHandler::BindKeyboardToWindow(window.get(), inputHandler);
-    Graphics::InputHandler::BindMouseToWindow(window.get(), inputHandler);
+    // Replays only see the recorded input, allocation checks keep
+    // the camera still
+    if (!replay && !zeroAllocFrames)
+    {
+        Graphics::InputHandler::BindKeyboardToWindow(window.get(), inputHandler);
+        Graphics::InputHandler::BindMouseToWindow(window.get(), inputHandler);
+    }
 
     inputHandler.BindMouse(
         GLFW_MOUSE_BUTTON_LEFT,
@@ -313,6 +472,22 @@ int main(int argc, char** argv)
     double currentTime = 0;
     double lastTime = 0;
     float deltaTime = 0;
+    std::vector<double> replayFrameMs{};
+
+    auto frameScheduler = Graphics::FrameScheduler{schedulerConfig};
+    auto& profiler = Graphics::Profiler::Get();
+    // The allocation check uses the profiler to report which passes allocated
+    profiler.SetEnabled(showImgui || zeroAllocFrames);
+    // Frames drawn before the allocation check starts, for caches and
+    // containers to reach their steady state sizes
+    constexpr auto sZeroAllocWarmupFrames = 60u;
+    unsigned zeroAllocChecked = 0;
+    unsigned zeroAllocFailed = 0;
+    const auto tracePath = GetBakDirectoryPath() / "main3d_trace.json";
+    // What was last drawn, to tell when a redraw is needed
+    auto drawnCameraPosition = camera.GetPosition();
+    auto drawnCameraAngle = camera.GetAngle();
+    auto drawnScreens = guiManager.mScreenStack.size();
 
     glfwSetCursorPos(window.get(), width/2, height/2);
     //glfwSetInputMode(window.get(), GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
@@ -343,65 +518,146 @@ int main(int argc, char** argv)
 
     do
     {
-        currentTime = glfwGetTime();
+        // While nothing is changing block until there is input or the
+        // idle frame is due, otherwise pace to the target frame rate
+        if (frameScheduler.IsIdle())
+            glfwWaitEventsTimeout(frameScheduler.GetIdleTimeout(glfwGetTime()));
+        else
+            frameScheduler.WaitForNextFrame(glfwGetTime());
+
+        const auto frameStart = glfwGetTime();
+        // Replays run on the recorded clock
+        if (replay)
+        {
+            const auto replayDelta = replay->NextFrame();
+            if (!replayDelta)
+                break;
+            currentTime = lastTime + *replayDelta;
+        }
+        else
+        {
+            currentTime = frameStart;
+        }
+
+        if (recorder)
+            recorder->BeginFrame(currentTime - lastTime);
+        profiler.BeginFrame();
+
+        if (benchmark && !benchmark->Update())
+            break;
 
         deltaTime = float(currentTime - lastTime);
-        guiManager.OnTimeDelta(currentTime - lastTime);
+        {
+            const auto profile = Graphics::ProfileScope{"Gui Time Delta", false};
+            guiManager.OnTimeDelta(currentTime - lastTime);
+        }
         lastTime = currentTime;
 
-        cameraPtr->SetDeltaTime(deltaTime);
+        // Don't let the camera jump after waiting idle for input
+        constexpr auto sMaxCameraDelta = 0.1f;
+        cameraPtr->SetDeltaTime(std::min(deltaTime, sMaxCameraDelta));
         gameState.SetLocation(cameraPtr->GetGameLocation());
-        guiManager.mFullMap.UpdateLocation();
 
-        glfwPollEvents();
+        {
+            // What the window system allocates is out of our hands
+            const auto untracked = Allocations::UntrackedScope{};
+            glfwPollEvents();
+        }
         glfwGetCursorPos(window.get(), &pointerPosX, &pointerPosY);
-        inputHandler.HandleInput(window.get());
+        if (replay)
+            replay->PlayFrame(inputHandler);
+        else
+            inputHandler.HandleInput(window.get());
 
-        // { *** Draw 3D World ***
-        UpdateLightCamera();
+        // Encounters would stop the benchmark waiting on dialogs
+        if (gameRunner.mGameState.mGameData && !benchmark)
+        {
+            const auto profile = Graphics::ProfileScope{"Game Update", false};
+            gameRunner.RunGameUpdate();
+        }
 
-        glDisable(GL_BLEND);
-        glDisable(GL_MULTISAMPLE);  
+        if (inputHandler.ConsumeInputReceived()
+            || guiManager.IsAnimating()
+            || cameraPtr->GetPosition() != drawnCameraPosition
+            || cameraPtr->GetAngle() != drawnCameraAngle
+            || guiManager.mScreenStack.size() != drawnScreens)
+        {
+            frameScheduler.RequestRedraw();
+        }
 
-        renderer.DrawForPicking(
-            gameRunner.mSystems->GetRenderables(),
-            gameRunner.mSystems->GetSprites(),
-            *cameraPtr);
+        if (!frameScheduler.ShouldDraw(currentTime))
+        {
+            frameScheduler.FrameSkipped();
+            profiler.EndFrame();
+            continue;
+        }
 
-        glEnable(GL_BLEND);
-        glEnable(GL_MULTISAMPLE);  
+        drawnCameraPosition = cameraPtr->GetPosition();
+        drawnCameraAngle = cameraPtr->GetAngle();
+        drawnScreens = guiManager.mScreenStack.size();
 
-        renderer.BeginDepthMapDraw();
-        renderer.DrawDepthMap(
-            gameRunner.mSystems->GetRenderables(),
-            lightCamera);
-        renderer.DrawDepthMap(
-            gameRunner.mSystems->GetSprites(),
-            lightCamera);
-        renderer.EndDepthMapDraw();
+        // { *** Draw 3D World ***
+        // Full screen GUIs hide the world entirely, don't draw it
+        const bool worldVisible = guiManager.IsWorldVisible();
+        if (worldVisible)
+        {
+            UpdateLightCamera();
+
+            glDisable(GL_BLEND);
+            glDisable(GL_MULTISAMPLE);  
+
+            {
+                const auto profile = Graphics::ProfileScope{"Picking", true};
+                renderer.DrawForPicking(
+                    gameRunner.mSystems->GetRenderables(),
+                    gameRunner.mSystems->GetSprites(),
+                    *cameraPtr);
+            }
+
+            glEnable(GL_BLEND);
+            glEnable(GL_MULTISAMPLE);  
+
+            const auto profile = Graphics::ProfileScope{"Shadow", true};
+            renderer.BeginDepthMapDraw();
+            renderer.DrawDepthMap(
+                gameRunner.mSystems->GetRenderables(),
+                lightCamera);
+            renderer.DrawDepthMap(
+                gameRunner.mSystems->GetSprites(),
+                lightCamera);
+            renderer.EndDepthMapDraw();
+        }
 
         glViewport(0, 0, static_cast<GLsizei>(width), static_cast<GLsizei>(height));
         // Dark blue background
         glClearColor(0.15f, 0.31f, 0.36f, 0.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-        renderer.DrawWithShadow(
-            gameRunner.mSystems->GetRenderables(),
-            light,
-            lightCamera,
-            *cameraPtr);
-
-        renderer.DrawWithShadow(
-            gameRunner.mSystems->GetSprites(),
-            light,
-            lightCamera,
-            *cameraPtr);
+        if (worldVisible)
+        {
+            const auto profile = Graphics::ProfileScope{"Main", true};
+            renderer.DrawWithShadow(
+                gameRunner.mSystems->GetRenderables(),
+                light,
+                lightCamera,
+                *cameraPtr);
+
+            renderer.DrawWithShadow(
+                gameRunner.mSystems->GetSprites(),
+                light,
+                lightCamera,
+                *cameraPtr);
+        }
 
         //// { *** Draw 2D GUI ***
-        guiRenderer.RenderGui(&root);
+        {
+            const auto profile = Graphics::ProfileScope{"Gui", true};
+            guiRenderer.RenderGui(&root);
+        }
 
         // { *** IMGUI START ***
         if (showImgui)
         {
+            profiler.BeginPass("ImGui", true);
 			ImGui_ImplOpenGL3_NewFrame();
 			ImGui_ImplGlfw_NewFrame();
 			ImGui::NewFrame();
@@ -410,13 +666,9 @@ int main(int argc, char** argv)
 
 			ShowCameraGui(camera);
 			console.Draw("Console", &consoleOpen);
+            ShowProfilerGui(profiler, tracePath);
 		}
 
-        if (gameRunner.mGameState.mGameData)
-        {
-            gameRunner.RunGameUpdate();
-        }
-
         if (showImgui && gameRunner.mActiveEncounter)
         {
             ImGui::Begin("Encounter");
@@ -467,6 +719,7 @@ int main(int argc, char** argv)
         if (showImgui)
         {
             ImguiWrapper::Draw(window.get());
+            profiler.EndPass();
         }
 
         if (showImgui)
@@ -488,15 +741,109 @@ int main(int argc, char** argv)
 
         // *** IMGUI END *** }
      
-        glfwSwapBuffers(window.get());
+        {
+            const auto untracked = Allocations::UntrackedScope{};
+            glfwSwapBuffers(window.get());
+        }
+        frameScheduler.FrameDrawn(currentTime);
+        profiler.EndFrame();
+
+        if (zeroAllocFrames
+            && frameScheduler.GetFramesDrawn() > sZeroAllocWarmupFrames)
+        {
+            const auto& allocations = profiler.GetLastFrameAllocations();
+            if (allocations.mAllocations > 0)
+            {
+                zeroAllocFailed++;
+                auto& error = logger.Error() << "Frame " << frameScheduler.GetFramesDrawn()
+                    << " allocated " << allocations.mAllocations << " times ("
+                    << allocations.mBytes << " bytes)";
+                for (const auto& pass : profiler.GetPasses())
+                {
+                    if (pass.mLastCounters.mAllocations > 0)
+                        error << " " << pass.mName << ": " << pass.mLastCounters.mAllocations;
+                }
+                error << "\n";
+            }
+            if (++zeroAllocChecked >= *zeroAllocFrames)
+                break;
+        }
+
+        if (benchmark || replay)
+        {
+            // Include the GPU's work in the frame time
+            glFinish();
+            const auto frameTime = glfwGetTime() - frameStart;
+            if (benchmark)
+                benchmark->FrameDone(frameTime);
+            else
+                replayFrameMs.emplace_back(frameTime * 1000.0);
+        }
     }
     while (glfwGetKey(window.get(), GLFW_KEY_ESCAPE) != GLFW_PRESS 
         && glfwWindowShouldClose(window.get()) == 0);
 
+    // Don't exit with a save still being written
+    BAK::SaveWriter::Get().Flush();
+    BAK::SaveWriter::Get().PollCompleted();
+
+    if (benchmark)
+    {
+        auto report = std::ofstream{*benchmarkReport};
+        benchmark->WriteReport(report);
+        logger.Info() << "Wrote benchmark report to " << *benchmarkReport << "\n";
+    }
+
+    if (recorder)
+    {
+        recorder->Finish(gameState.Hash());
+    }
+
+    bool replayMatched = true;
+    if (replay)
+    {
+        const auto complete = replay->GetCurrentFrame() == replay->GetFrameCount();
+        const auto hash = gameState.Hash();
+        const auto expected = replay->GetExpectedHash();
+        replayMatched = complete && expected == hash;
+        if (replayMatched)
+            logger.Info() << "Replay finished in the recorded state\n";
+        else
+            logger.Error() << "Replay did not finish in the recorded state, played "
+                << replay->GetCurrentFrame() << " of " << replay->GetFrameCount()
+                << " frames, hash: " << std::hex << hash << " expected: "
+                << expected.value_or(0) << std::dec << "\n";
+
+        auto reportPath = *replayLog;
+        reportPath += ".json";
+        auto report = std::ofstream{reportPath};
+        report << "{\n  \"matched\": " << (replayMatched ? "true" : "false")
+            << ",\n  \"stats\": ";
+        Game::WriteFrameStats(report, "replay", replayFrameMs);
+        report << ",\n  \"frameMs\": [";
+        for (unsigned i = 0; i < replayFrameMs.size(); i++)
+            report << (i % 16 == 0 ? "\n    " : " ") << replayFrameMs[i]
+                << (i + 1 < replayFrameMs.size() ? "," : "");
+        report << "\n  ]\n}\n";
+        logger.Info() << "Wrote replay report to " << reportPath << "\n";
+    }
+
+    logger.Info() << "Frames drawn: " << frameScheduler.GetFramesDrawn()
+        << " skipped: " << frameScheduler.GetFramesSkipped() << "\n";
+
     if (showImgui)
     {
         ImguiWrapper::Shutdown();
     }
 
-    return 0;
+    if (zeroAllocFrames)
+    {
+        if (zeroAllocFailed == 0)
+            logger.Info() << "No allocations in " << zeroAllocChecked << " steady state frames\n";
+        else
+            logger.Error() << zeroAllocFailed << " of " << zeroAllocChecked
+                << " steady state frames allocated\n";
+    }
+
+    return replayMatched && zeroAllocFailed == 0 ? 0 : 1;
 }
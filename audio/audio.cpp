@@ -11,24 +11,14 @@ AudioManager::AudioManager()
     mCurrentMusicTrack{nullptr},
     mMusicStack{},
     mSoundQueue{},
-    mSoundPlaying{},
+    mSoundPlaying{false},
+    mFinishedSound{nullptr},
+    mSoundQueueWakeups{0},
+    mSoundDataMutex{},
     mSoundData{},
     mMusicData{},
     mRunning{true},
-    mQueuePlayThread{[this]{
-        using namespace std::chrono_literals;
-        while (mRunning)
-        {
-            if (!mSoundPlaying && !mSoundQueue.empty())
-            {
-                std::this_thread::sleep_for(1ms);
-                auto sound = Get().mSoundQueue.front();
-                Get().mSoundQueue.pop();
-                Get().PlaySoundImpl(sound);
-            }
-            std::this_thread::sleep_for(10ms);
-        }
-    }},
+    mQueuePlayThread{},
     mLogger{Logging::LogState::GetLogger("AudioManager")}
 {
     if (SDL_Init(SDL_INIT_AUDIO) < 0)
@@ -47,6 +37,9 @@ AudioManager::AudioManager()
     //Mix_SetMidiPlayer(MIDI_ADLMIDI);
     Mix_SetMidiPlayer(MIDI_OPNMIDI);
     //Mix_SetMidiPlayer(MIDI_Fluidsynth);
+
+    // Start the sound thread once the mixer is ready for it
+    mQueuePlayThread = std::thread{[this]{ RunSoundQueue(); }};
 }
 
 AudioManager& AudioManager::Get()
@@ -111,43 +104,103 @@ void AudioManager::PopTrack()
 void AudioManager::PlaySound(SoundIndex sound)
 {
     mLogger.Debug() << "Queueing sound: " << sound << "\n";
-    mSoundQueue.emplace(sound);
+    if (!mSoundQueue.Push(QueuedSound{sound, std::chrono::steady_clock::now()}))
+    {
+        mLogger.Warn() << "Sound queue full, dropping sound: " << sound << "\n";
+        return;
+    }
+    WakeSoundThread();
+}
+
+void AudioManager::WakeSoundThread()
+{
+    mSoundQueueWakeups.fetch_add(1);
+    mSoundQueueWakeups.notify_one();
+}
+
+void AudioManager::RunSoundQueue()
+{
+    while (mRunning)
+    {
+        // Read before looking for work so a wakeup that arrives while
+        // looking isn't missed
+        const auto wakeups = mSoundQueueWakeups.load();
+
+        if (auto* finished = mFinishedSound.exchange(nullptr))
+        {
+            FreeSound(finished);
+            mSoundPlaying = false;
+        }
+
+        if (!mSoundPlaying)
+        {
+            if (const auto queued = mSoundQueue.Pop())
+            {
+                const auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - queued->mQueueTime);
+                mLogger.Debug() << "Sound: " << queued->mSound << " waited "
+                    << latency.count() << "us in the queue\n";
+                PlaySoundImpl(queued->mSound);
+                continue;
+            }
+        }
+
+        mSoundQueueWakeups.wait(wakeups);
+    }
 }
 
 void AudioManager::PlaySoundImpl(SoundIndex sound)
 {
     mLogger.Debug()  << "Playing sound: " << sound << "\n";
 
+    auto lock = std::lock_guard{mSoundDataMutex};
     mSoundPlaying = true;
     std::visit(overloaded{
-        [](Mix_Music* music){
-            Mix_PlayMusicStream(music, 1);
+        [&](Mix_Music* music){
             Mix_HookMusicStreamFinished(music, &AudioManager::RewindMusic, nullptr);
+            if (Mix_PlayMusicStream(music, 1) < 0)
+            {
+                // Won't get a finished callback, don't wait for one
+                mLogger.Error() << "Couldn't play sound: " << sound
+                    << " " << Mix_GetError() << std::endl;
+                mSoundPlaying = false;
+            }
         },
-        [](Mix_Chunk* chunk){
-            
+        [&](Mix_Chunk* chunk){
+            mSoundPlaying = false;
         }},
         GetSound(sound));
 }
 
 void AudioManager::RewindMusic(Mix_Music* music, void*)
+{
+    // Runs on SDL's audio thread, hand the music back to the sound
+    // thread to free and play the next sound
+    auto& audioManager = Get();
+    audioManager.mFinishedSound = music;
+    audioManager.WakeSoundThread();
+}
+
+void AudioManager::FreeSound(Mix_Music* music)
 {
     // This seems to be necessary for some midi snippets that e.g. 61 DRAG
     // that stop playing back after they've been played once or twice...
     //Mix_RewindMusicStream(music);
-    Mix_FreeMusic(music);
-    auto& soundData = Get().mSoundData;
-    soundData.erase(
-        std::find_if(
-            soundData.begin(),
-            soundData.end(),
-            [music](const auto& sound)
-            {
-                return std::holds_alternative<Mix_Music*>(sound.second) 
-                    && std::get<Mix_Music*>(sound.second) == music;
-            }));
+    auto lock = std::lock_guard{mSoundDataMutex};
+    const auto it = std::find_if(
+        mSoundData.begin(),
+        mSoundData.end(),
+        [music](const auto& sound)
+        {
+            return std::holds_alternative<Mix_Music*>(sound.second) 
+                && std::get<Mix_Music*>(sound.second) == music;
+        });
+    // Already freed if the sounds were cleared while it played
+    if (it == mSoundData.end())
+        return;
 
-    Get().mSoundPlaying = false;
+    Mix_FreeMusic(music);
+    mSoundData.erase(it);
 }
 
 void AudioManager::StopMusicTrack()
@@ -241,6 +294,7 @@ void AudioManager::ClearSounds()
     }
     mMusicData.clear();
 
+    auto lock = std::lock_guard{mSoundDataMutex};
     for (auto& [_, sound] : mSoundData)
     {
         std::visit(overloaded{
@@ -257,14 +311,17 @@ void AudioManager::ClearSounds()
 
     while (!mMusicStack.empty()) mMusicStack.pop();
 
+    mFinishedSound = nullptr;
     mSoundPlaying = false;
+    WakeSoundThread();
 }
 
 AudioManager::~AudioManager()
 {
-    ClearSounds();
     mRunning = false;
+    WakeSoundThread();
     mQueuePlayThread.join();
+    ClearSounds();
     Mix_CloseAudio();
     SDL_Quit();
 }
@@ -1,15 +1,17 @@
 #pragma once
 
 #include "com/logger.hpp"
+#include "com/spscQueue.hpp"
 #include "com/strongType.hpp"
 #include "com/visit.hpp"
 
 #include <SDL2/SDL.h>
 #include "SDL_mixer_ext/SDL_mixer_ext.h"
 
+#include <atomic>
 #include <chrono>
+#include <mutex>
 #include <ostream>
-#include <queue>
 #include <stack>
 #include <thread>
 #include <variant>
@@ -45,9 +47,16 @@ class AudioManager
     static constexpr auto sAudioVolume{MIX_MAX_VOLUME};
     static constexpr auto sMusicTempo{0.9};
     static constexpr auto sFadeOutTime{1500};
+    static constexpr auto sSoundQueueSize{32};
 
     using Sound = std::variant<Mix_Music*, Mix_Chunk*>;
 
+    struct QueuedSound
+    {
+        SoundIndex mSound;
+        std::chrono::steady_clock::time_point mQueueTime;
+    };
+
 public:
     static AudioManager& Get();
 
@@ -57,6 +66,7 @@ public:
     void PlayMusicTrack();
     void StopMusicTrack();
 
+    // Queues a sound for the sound thread, call from the game thread only
     void PlaySound(SoundIndex);
     void PlaySoundImpl(SoundIndex);
 
@@ -71,6 +81,10 @@ private:
 
     static void RewindMusic(Mix_Music*, void*);
 
+    void RunSoundQueue();
+    void WakeSoundThread();
+    void FreeSound(Mix_Music*);
+
     void ClearSounds();
 
     AudioManager();
@@ -78,13 +92,21 @@ private:
 
     Mix_Music* mCurrentMusicTrack;
     std::stack<Mix_Music*> mMusicStack;
-    std::queue<SoundIndex> mSoundQueue;
-    bool mSoundPlaying;
 
+    // Sounds go from the game thread to the sound thread through
+    // mSoundQueue. The sound thread sleeps on mSoundQueueWakeups until
+    // a sound is queued or the playing one finishes.
+    SpscQueue<QueuedSound, sSoundQueueSize> mSoundQueue;
+    std::atomic<bool> mSoundPlaying;
+    std::atomic<Mix_Music*> mFinishedSound;
+    std::atomic<unsigned> mSoundQueueWakeups;
+
+    // mSoundData is loaded by the sound thread and cleared by the game thread
+    std::mutex mSoundDataMutex;
     std::unordered_map<SoundIndex, Sound> mSoundData;
     std::unordered_map<MusicIndex, Mix_Music*> mMusicData;
 
-    bool mRunning;
+    std::atomic<bool> mRunning;
     std::thread mQueuePlayThread;
 
     const Logging::Logger& mLogger;
@@ -43,6 +43,7 @@ public:
     virtual ShopStats& GetShop() = 0;
     virtual const ShopStats& GetShop() const = 0;
     virtual LockStats& GetLock() = 0;
+    virtual const LockStats& GetLock() const = 0;
     bool IsShop() const;
     bool HasLock() const;
 };
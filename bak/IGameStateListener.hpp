@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+
+namespace BAK {
+
+// What changed in a GameState notification, combined as a bitmask
+namespace GameStateChange {
+    using Mask = std::uint8_t;
+    static constexpr Mask Position = 1 << 0;
+    static constexpr Mask Heading  = 1 << 1;
+    static constexpr Mask Zone     = 1 << 2;
+    static constexpr Mask Time     = 1 << 3;
+    static constexpr Mask Party    = 1 << 4;
+    static constexpr Mask All      = Position | Heading | Zone | Time | Party;
+}
+
+// Told when the game state changes in ways displays care about,
+// so they don't need to poll it every frame
+class IGameStateListener
+{
+public:
+    virtual void OnGameStateChanged(GameStateChange::Mask changes) = 0;
+    virtual ~IGameStateListener() = default;
+};
+
+}
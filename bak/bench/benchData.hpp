@@ -0,0 +1,551 @@
+#pragma once
+
+#include "bak/file/fileBuffer.hpp"
+#include "bak/fileBufferFactory.hpp"
+#include "bak/gameData.hpp"
+#include "bak/objectInfo.hpp"
+#include "bak/palette.hpp"
+#include "bak/skills.hpp"
+
+#include "com/random.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Synthetic stand-ins for the game's data files so the benchmarks run
+// without a copy of the game. Everything is generated from fixed keys
+// so every run measures the same input. A few benchmarks of whole
+// stores need the real files and are skipped without them.
+namespace BAK::Bench {
+
+// Indexed colour pixels that look roughly like the game's images:
+// horizontal runs of a colour, with each row mostly repeating the
+// one above it
+inline std::vector<std::uint8_t> MakePixels(unsigned width, unsigned height, std::uint64_t key = 1)
+{
+    auto pixels = std::vector<std::uint8_t>(width * height);
+    std::uint64_t counter = 0;
+    const auto Next = [&]{ return Random::Generate(key, counter++); };
+
+    for (unsigned y = 0; y < height; y++)
+    {
+        for (unsigned x = 0; x < width;)
+        {
+            const auto run = 1 + Random::Bounded(Next(), 12);
+            const bool repeatRow = y > 0 && Random::Bounded(Next(), 4) != 0;
+            const auto colour = static_cast<std::uint8_t>(Random::Bounded(Next(), 256));
+            for (unsigned i = 0; i < run && x < width; i++, x++)
+            {
+                const auto index = y * width + x;
+                pixels[index] = repeatRow ? pixels[index - width] : colour;
+            }
+        }
+    }
+    return pixels;
+}
+
+inline FileBuffer ToFileBuffer(const std::vector<std::uint8_t>& data)
+{
+    auto fb = FileBuffer{static_cast<unsigned>(data.size())};
+    fb.PutData(const_cast<std::uint8_t*>(data.data()), data.size());
+    fb.Rewind();
+    return fb;
+}
+
+inline FileBuffer Shrink(FileBuffer& fb, unsigned size)
+{
+    fb.Rewind();
+    auto result = FileBuffer{size};
+    result.CopyFrom(&fb, size);
+    result.Rewind();
+    return result;
+}
+
+inline FileBuffer Compress(const std::vector<std::uint8_t>& data, unsigned method)
+{
+    auto input = ToFileBuffer(data);
+    auto output = FileBuffer{static_cast<unsigned>(data.size() * 2 + 16)};
+    const auto size = input.Compress(&output, method);
+    return Shrink(output, size);
+}
+
+inline FileBuffer CompressRLE(const std::vector<std::uint8_t>& data)
+{
+    return Compress(data, COMPRESSION_RLE);
+}
+
+inline FileBuffer CompressLZSS(const std::vector<std::uint8_t>& data)
+{
+    return Compress(data, COMPRESSION_LZSS);
+}
+
+// Without the header Decompress checks
+inline FileBuffer CompressLZW(const std::vector<std::uint8_t>& data)
+{
+    return Compress(data, COMPRESSION_LZW);
+}
+
+// A BMX file of uncompressed images packed with LZW, as read by LoadImages
+inline FileBuffer MakeBmx(unsigned images, unsigned width, unsigned height)
+{
+    auto pixels = std::vector<std::uint8_t>{};
+    for (unsigned i = 0; i < images; i++)
+    {
+        const auto image = MakePixels(width, height, i + 1);
+        pixels.insert(pixels.end(), image.begin(), image.end());
+    }
+    auto compressed = CompressLZW(pixels);
+
+    constexpr unsigned sImageHeader = 8;
+    auto fb = FileBuffer{static_cast<unsigned>(
+        12 + images * sImageHeader + 5 + compressed.GetSize())};
+    fb.PutUint16LE(0x1066);
+    fb.PutUint16LE(COMPRESSION_LZW);
+    fb.PutUint16LE(images);
+    fb.PutUint16LE(0);
+    fb.PutUint32LE(pixels.size());
+    for (unsigned i = 0; i < images; i++)
+    {
+        fb.PutUint16LE(width * height);
+        fb.PutUint16LE(0);
+        fb.PutUint16LE(width);
+        fb.PutUint16LE(height);
+    }
+    fb.PutUint8(0x02);
+    fb.PutUint32LE(pixels.size());
+    fb.CopyFrom(&compressed, compressed.GetSize());
+    fb.Rewind();
+    return fb;
+}
+
+inline Palette MakePalette()
+{
+    auto colors = std::vector<glm::vec4>{};
+    for (unsigned i = 0; i < 256; i++)
+        colors.emplace_back(
+            (i & 0x7) / 7.0f,
+            ((i >> 3) & 0x7) / 7.0f,
+            (i >> 6) / 3.0f,
+            i == 0 ? 0.0f : 1.0f);
+    return Palette{std::move(colors)};
+}
+
+// A DDX dialog file as read by DialogStore::Load: the key to offset
+// table, then snippets with a few choices and actions and some text
+inline FileBuffer MakeDialogFile(unsigned dialogs)
+{
+    constexpr unsigned sSnippetHeader = 9;
+    constexpr unsigned sChoiceSize = 10;
+    constexpr unsigned sActionSize = 10;
+    constexpr std::uint32_t sKeyTargetBit = 0xf0000000;
+
+    const auto filler = std::string{
+        "The road wound north through the forest towards the ruins, "
+        "and the party walked on in silence as the light began to fade "
+        "behind the hills and the first of the stars came out."};
+    const auto MakeText = [&](unsigned i)
+    {
+        return "Snippet " + std::to_string(i) + ": "
+            + filler.substr(0, 20 + (i * 37) % (filler.size() - 20));
+    };
+    const auto Choices = [](unsigned i) { return i % 3; };
+    const auto Actions = [](unsigned i) { return 1 + i % 2; };
+
+    auto offsets = std::vector<std::uint32_t>{};
+    unsigned size = 2 + dialogs * 8;
+    for (unsigned i = 0; i < dialogs; i++)
+    {
+        offsets.emplace_back(size);
+        size += sSnippetHeader
+            + Choices(i) * sChoiceSize
+            + Actions(i) * sActionSize
+            + MakeText(i).size() + 1;
+    }
+
+    auto fb = FileBuffer{size};
+    fb.PutUint16LE(dialogs);
+    for (unsigned i = 0; i < dialogs; i++)
+    {
+        fb.PutUint32LE(0x10000 + i);
+        fb.PutUint32LE(offsets[i]);
+    }
+
+    for (unsigned i = 0; i < dialogs; i++)
+    {
+        const auto text = MakeText(i);
+        fb.PutUint8(i % 4);
+        fb.PutUint16LE(i % 8);
+        fb.PutUint8(0);
+        fb.PutUint8(0);
+        fb.PutUint8(Choices(i));
+        fb.PutUint8(Actions(i));
+        fb.PutUint16LE(text.size() + 1);
+
+        // Alternate between offset and key targets
+        for (unsigned j = 0; j < Choices(i); j++)
+        {
+            fb.PutUint16LE(0x100 + j);
+            fb.PutUint16LE(1);
+            fb.PutUint16LE(0xffff);
+            fb.PutUint32LE(j % 2 == 0
+                ? offsets[(i + j + 1) % dialogs]
+                : sKeyTargetBit | (0x10000 + i));
+        }
+
+        for (unsigned j = 0; j < Actions(i); j++)
+        {
+            if (j == 0)
+            {
+                // SetFlag
+                fb.PutUint16LE(0x04);
+                fb.PutUint16LE(0x1000 + i);
+                fb.PutUint8(0xff);
+                fb.PutUint8(1);
+                fb.PutUint16LE(0);
+                fb.PutUint16LE(1);
+            }
+            else
+            {
+                // PushNextDialog
+                fb.PutUint16LE(0x10);
+                fb.PutUint32LE(offsets[(i + 1) % dialogs]);
+                fb.Skip(4);
+            }
+        }
+
+        fb.PutString(text);
+    }
+    fb.Rewind();
+    return fb;
+}
+
+// The DEF_*.DAT encounter definitions read by Encounter::EncounterFactory,
+// with sEncounterDefinitions of each kind. These are only used when
+// the data directory doesn't have the real files.
+inline constexpr unsigned sEncounterDefinitions = 4;
+
+inline void AddEncounterDefinitions()
+{
+    auto& factory = FileBufferFactory::Get();
+    constexpr auto n = sEncounterDefinitions;
+
+    const auto PutPositionAndHeading = [](FileBuffer& fb, unsigned i)
+    {
+        fb.PutUint32LE(1000 + i * 3000);
+        fb.PutUint32LE(2000 + i * 1000);
+        fb.PutUint16LE((i % 4) << 14);
+    };
+
+    for (const auto* file : {"DEF_BKGR.DAT", "DEF_TOWN.DAT"})
+    {
+        auto fb = FileBuffer{4 + n * 22};
+        fb.PutUint32LE(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            fb.Skip(3);
+            fb.PutUint8(10 + i);
+            fb.PutUint8(1);
+            fb.Skip(2);
+            fb.PutUint32LE(0x20000 + i);
+            fb.PutUint32LE(0x30000 + i);
+            fb.PutUint8(8 + i);
+            fb.PutUint8(16 + i);
+            fb.PutUint16LE(0x4000);
+            fb.PutUint8(i % 2);
+            fb.PutUint16LE(0);
+        }
+        factory.AddFallbackDataBuffer(file, std::move(fb));
+    }
+
+    for (const bool isTrap : {false, true})
+    {
+        constexpr unsigned sMaxCombatants = 7;
+        constexpr unsigned sCombatantSize = 48;
+        constexpr unsigned sCombatants = 3;
+        const unsigned combatSize = 5 + 16 + (isTrap ? 10 : 0) + 4 * 10
+            + 1 + sMaxCombatants * sCombatantSize + 2;
+
+        auto fb = FileBuffer{2 + n * combatSize};
+        fb.PutUint16LE(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            fb.Skip(5);
+            fb.PutUint32LE(i);
+            fb.PutUint32LE(0x40000 + i);
+            fb.PutUint32LE(0x50000 + i);
+            fb.PutUint32LE(0);
+            if (isTrap)
+                PutPositionAndHeading(fb, 0);
+            for (unsigned retreat = 0; retreat < 4; retreat++)
+                PutPositionAndHeading(fb, retreat);
+
+            fb.PutUint8(sCombatants);
+            for (unsigned j = 0; j < sCombatants; j++)
+            {
+                fb.PutUint16LE(j);
+                fb.PutUint16LE(1);
+                PutPositionAndHeading(fb, j);
+                fb.Skip(sCombatantSize - 14);
+            }
+            fb.Skip((sMaxCombatants - sCombatants) * sCombatantSize);
+            fb.Skip(2);
+        }
+        factory.AddFallbackDataBuffer(isTrap ? "DEF_TRAP.DAT" : "DEF_COMB.DAT", std::move(fb));
+    }
+
+    {
+        auto fb = FileBuffer{2 + n * 9};
+        fb.PutUint16LE(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            fb.Skip(5);
+            fb.PutUint32LE(0x60000 + i);
+        }
+        factory.AddFallbackDataBuffer("DEF_DIAL.DAT", std::move(fb));
+    }
+
+    for (const auto* file : {"DEF_ENAB.DAT", "DEF_DISA.DAT"})
+    {
+        auto fb = FileBuffer{4 + n * 8};
+        fb.PutUint32LE(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            fb.Skip(3);
+            fb.PutUint8(25 * (i + 1));
+            fb.PutUint16LE(0x1000 + i);
+            fb.PutUint16LE(0);
+        }
+        factory.AddFallbackDataBuffer(file, std::move(fb));
+    }
+
+    {
+        auto fb = FileBuffer{4 + n * 9};
+        fb.PutUint32LE(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            fb.Skip(3);
+            fb.PutUint32LE(0x70000 + i);
+            fb.PutUint16LE(0);
+        }
+        factory.AddFallbackDataBuffer("DEF_BLOC.DAT", std::move(fb));
+    }
+
+    {
+        auto fb = FileBuffer{4 + n * 20};
+        fb.PutUint32LE(n);
+        for (unsigned i = 0; i < n; i++)
+        {
+            fb.Skip(3);
+            fb.PutUint8(1 + i);
+            fb.PutUint8(10 + i);
+            fb.PutUint8(15 + i);
+            fb.PutUint8(8);
+            fb.PutUint8(16);
+            fb.PutUint16LE(0x4000);
+            fb.PutUint32LE(0x80000 + i);
+            fb.PutUint32LE(0);
+            fb.PutUint16LE(0);
+        }
+        factory.AddFallbackDataBuffer("DEF_ZONE.DAT", std::move(fb));
+    }
+}
+
+// A tile's encounter data as read by Encounter::EncounterStore: the
+// most encounters a chapter can have, for each of the ten chapters,
+// cycling through the kinds of encounter
+inline FileBuffer MakeEncounterTile()
+{
+    constexpr unsigned sChapters = 10;
+    constexpr unsigned sEncounters = 10;
+    constexpr unsigned sEncounterSize = 0x13;
+    constexpr auto sTypes = std::array<std::uint16_t, 9>{
+        0x0, 0x1, 0x3, 0x6, 0x7, 0x8, 0x9, 0xa, 0xb};
+
+    auto fb = FileBuffer{sChapters * (sEncounters * sEncounterSize + 2)};
+    for (unsigned chapter = 0; chapter < sChapters; chapter++)
+    {
+        fb.PutUint16LE(sEncounters);
+        for (unsigned i = 0; i < sEncounters; i++)
+        {
+            fb.PutUint16LE(sTypes[(chapter + i) % sTypes.size()]);
+            // left, top, right, bottom
+            fb.PutUint8(2 * i);
+            fb.PutUint8(2 * i + 4);
+            fb.PutUint8(2 * i + 3);
+            fb.PutUint8(2 * i);
+            fb.PutUint16LE((chapter + i) % sEncounterDefinitions);
+            fb.Skip(3);
+            fb.PutUint16LE(0x100 + i);
+            fb.PutUint16LE(0);
+            fb.PutUint16LE(0);
+            fb.PutUint16LE(0);
+        }
+    }
+    fb.Rewind();
+    return fb;
+}
+
+// The object and spell definitions a save needs: OBJINFO.DAT, and
+// SPELLS.DAT, SPELLDOC.DAT and the SYMBOL files with a single spell.
+// These are only used when the data directory doesn't have the real
+// files.
+inline void AddGameDataDefinitions()
+{
+    auto& factory = FileBufferFactory::Get();
+    const auto name = std::string{"Synthetic"};
+
+    {
+        constexpr unsigned sObjectSize = 80;
+        auto fb = FileBuffer{ObjectIndex::sObjectCount * sObjectSize};
+        for (unsigned i = 0; i < ObjectIndex::sObjectCount; i++)
+        {
+            fb.PutString("Item" + std::to_string(i), 30);
+            fb.Skip(6);
+            // Level and value
+            fb.PutSint16LE(1);
+            fb.PutSint16LE(10 + i);
+            fb.Skip(10);
+            fb.PutUint16LE(1);
+            // Sound, sound count, stack size, default stack size
+            fb.PutUint8(0);
+            fb.PutUint8(0);
+            fb.PutUint8(1);
+            fb.PutUint8(1);
+            fb.Skip(sObjectSize - 56);
+        }
+        factory.AddFallbackDataBuffer("OBJINFO.DAT", std::move(fb));
+    }
+
+    {
+        constexpr unsigned sSpellFields = 11;
+        auto fb = FileBuffer{2 + sSpellFields * 2 + 2 + static_cast<unsigned>(name.size()) + 1};
+        fb.PutUint16LE(1);
+        fb.PutUint16LE(0);
+        fb.PutUint16LE(1);
+        fb.PutUint16LE(5);
+        fb.PutUint16LE(0);
+        fb.PutUint16LE(0);
+        fb.PutUint16LE(0xffff);
+        fb.PutUint16LE(0xffff);
+        fb.PutUint16LE(0xffff);
+        fb.PutUint16LE(0);
+        fb.PutSint16LE(10);
+        fb.PutSint16LE(0);
+        fb.PutUint16LE(0);
+        fb.PutString(name);
+        factory.AddFallbackDataBuffer("SPELLS.DAT", std::move(fb));
+    }
+
+    {
+        // Title, cost, damage, duration, line of sight and two lines
+        // of description
+        constexpr unsigned sStrings = 7;
+        auto fb = FileBuffer{2 + sStrings * 4 + 2 + sStrings * static_cast<unsigned>(name.size() + 1)};
+        fb.PutUint16LE(sStrings);
+        for (unsigned i = 0; i < sStrings; i++)
+            fb.PutUint32LE(i * (name.size() + 1));
+        fb.Skip(2);
+        for (unsigned i = 0; i < sStrings; i++)
+            fb.PutString(name);
+        factory.AddFallbackDataBuffer("SPELLDOC.DAT", std::move(fb));
+    }
+
+    for (unsigned i = 1; i < 7; i++)
+    {
+        auto fb = FileBuffer{2};
+        fb.PutUint16LE(0);
+        factory.AddFallbackDataBuffer("SYMBOL" + std::to_string(i) + ".DAT", std::move(fb));
+    }
+}
+
+// A save with three active characters and empty inventories, big
+// enough for everything GameData reads from it
+inline void WriteSave(const std::string& path)
+{
+    constexpr unsigned sSaveSize = GameData::sCombatInventoryOffset + 0x8000;
+    const auto names = std::array<std::string, GameData::sCharacterCount>{
+        "Locklear", "Gorath", "Owyn", "Pug", "James", "Patrus"};
+
+    auto fb = FileBuffer{sSaveSize};
+    fb.PutString("Synthetic");
+
+    fb.Seek(GameData::sChapterOffset);
+    fb.PutUint16LE(1);
+    fb.Seek(GameData::sGoldOffset);
+    fb.PutUint32LE(1000);
+    fb.Seek(GameData::sTimeOffset);
+    fb.PutUint32LE(0x1000);
+    fb.PutUint32LE(0x100);
+
+    fb.Seek(GameData::sLocationOffset);
+    fb.PutUint8(1);
+    fb.PutUint8(10);
+    fb.PutUint8(15);
+    fb.PutUint32LE(10 * 64000 + 32000);
+    fb.PutUint32LE(15 * 64000 + 32000);
+    fb.Skip(5);
+    fb.PutUint8(0x40);
+
+    for (unsigned character = 0; character < names.size(); character++)
+    {
+        fb.Seek(GameData::GetCharacterNameOffset(character));
+        fb.PutString(names[character], GameData::sCharacterNameLength);
+
+        // Name offset and spells, then max, true, current,
+        // experience and modifier of each skill
+        fb.Seek(GameData::GetCharacterSkillOffset(character));
+        fb.Skip(2 + 6);
+        for (unsigned i = 0; i < Skills::sSkills; i++)
+        {
+            const auto value = static_cast<std::uint8_t>(20 + (character * 7 + i * 3) % 60);
+            fb.PutUint8(value);
+            fb.PutUint8(value);
+            fb.PutUint8(value);
+            fb.PutUint8(0);
+            fb.PutSint8(0);
+        }
+
+        fb.Seek(GameData::GetCharacterInventoryOffset(character));
+        fb.PutUint8(0);
+        fb.PutUint16LE(5);
+    }
+
+    fb.Seek(GameData::sActiveCharactersOffset);
+    fb.PutUint8(3);
+    for (unsigned character = 0; character < 3; character++)
+        fb.PutUint8(character);
+
+    fb.Seek(GameData::sPartyKeyInventoryOffset);
+    fb.PutUint8(0);
+    fb.PutUint16LE(20);
+
+    auto out = std::ofstream{path, std::ios::binary | std::ios::out};
+    fb.Save(out);
+}
+
+// Some benchmarks need the real game files, skip them when the data
+// directory doesn't have them
+inline bool HaveData(benchmark::State& state, const std::string& file)
+{
+    if (FileBufferFactory::Get().DataBufferExists(file))
+        return true;
+    state.SkipWithError((file + " not found in the game data directory").c_str());
+    return false;
+}
+
+inline bool HaveSave(benchmark::State& state, const std::string& file)
+{
+    if (FileBufferFactory::Get().SaveBufferExists(file))
+        return true;
+    state.SkipWithError((file + " not found in the save directory").c_str());
+    return false;
+}
+
+}
@@ -0,0 +1,79 @@
+#include "bak/bench/benchData.hpp"
+
+#include "bak/imageStore.hpp"
+#include "bak/textureFactory.hpp"
+
+#include <benchmark/benchmark.h>
+
+namespace BAK::Bench {
+
+namespace {
+
+constexpr auto sWidth = 320;
+constexpr auto sHeight = 200;
+
+template <typename Decompress>
+void RunDecompress(benchmark::State& state, FileBuffer compressed, Decompress&& decompress)
+{
+    auto output = FileBuffer{sWidth * sHeight};
+    for (auto _ : state)
+    {
+        compressed.Rewind();
+        benchmark::DoNotOptimize(decompress(compressed, output));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * output.GetSize());
+}
+
+}
+
+static void BM_DecompressLZW(benchmark::State& state)
+{
+    RunDecompress(state, CompressLZW(MakePixels(sWidth, sHeight)),
+        [](auto& in, auto& out){ return in.DecompressLZW(&out); });
+}
+BENCHMARK(BM_DecompressLZW);
+
+static void BM_DecompressLZSS(benchmark::State& state)
+{
+    RunDecompress(state, CompressLZSS(MakePixels(sWidth, sHeight)),
+        [](auto& in, auto& out){ return in.DecompressLZSS(&out); });
+}
+BENCHMARK(BM_DecompressLZSS);
+
+static void BM_DecompressRLE(benchmark::State& state)
+{
+    RunDecompress(state, CompressRLE(MakePixels(sWidth, sHeight)),
+        [](auto& in, auto& out){ return in.DecompressRLE(&out); });
+}
+BENCHMARK(BM_DecompressRLE);
+
+static void BM_LoadImages(benchmark::State& state)
+{
+    const auto images = static_cast<unsigned>(state.range(0));
+    auto bmx = MakeBmx(images, 32, 32);
+    for (auto _ : state)
+    {
+        bmx.Rewind();
+        benchmark::DoNotOptimize(LoadImages(bmx));
+    }
+    state.SetItemsProcessed(state.iterations() * images);
+}
+BENCHMARK(BM_LoadImages)->Arg(8)->Arg(32);
+
+static void BM_ImageToTexture(benchmark::State& state)
+{
+    const auto pixels = MakePixels(sWidth, sHeight);
+    auto image = Image{sWidth, sHeight, 0, false};
+    std::copy(pixels.begin(), pixels.end(), image.GetPixels());
+    const auto palette = MakePalette();
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(ImageToTexture(image, palette));
+    }
+    state.SetItemsProcessed(state.iterations() * image.GetSize());
+}
+BENCHMARK(BM_ImageToTexture);
+
+}
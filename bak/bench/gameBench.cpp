@@ -0,0 +1,264 @@
+#include "bak/bench/benchData.hpp"
+
+#include "bak/character.hpp"
+#include "bak/dialog.hpp"
+#include "bak/gameData.hpp"
+#include "bak/gameState.hpp"
+#include "bak/inventory.hpp"
+#include "bak/inventoryItem.hpp"
+#include "bak/saveWriter.hpp"
+#include "bak/textVariableStore.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <unordered_map>
+
+namespace BAK::Bench {
+
+namespace {
+
+constexpr auto sSave = "NEW_GAME.GAM";
+
+GameObject MakeObject(const std::string& name, ItemType type, std::uint16_t modifierMask, std::int16_t modifier)
+{
+    return GameObject{
+        name,
+        1, 1, 1,
+        1, 1, 1, 1,
+        0, 1, 0, 0, 0, 0,
+        RacialModifier::None,
+        0,
+        type,
+        0, 0, 0,
+        modifierMask, modifier,
+        0, 0, 0};
+}
+
+struct ItemSet
+{
+    ItemSet()
+    :
+        mObjects{}
+    {
+        mObjects.reserve(sItems);
+        for (unsigned i = 0; i < sItems; i++)
+        {
+            // Some items modify a skill, as rings and armour do
+            const auto skill = i % Skills::sSkills;
+            mObjects.emplace_back(MakeObject(
+                "Item" + std::to_string(i),
+                ItemType::Other,
+                static_cast<std::uint16_t>(i % 3 == 0 ? 1 << skill : 0),
+                static_cast<std::int16_t>(i % 3 == 0 ? 5 : 0)));
+        }
+    }
+
+    InventoryItem MakeItem(unsigned i) const
+    {
+        return InventoryItem{
+            &mObjects[i],
+            ItemIndex{static_cast<std::uint8_t>(i)},
+            1,
+            0,
+            0};
+    }
+
+    static constexpr unsigned sItems = 24;
+    std::vector<GameObject> mObjects;
+};
+
+Character MakeCharacter(const ItemSet& items)
+{
+    auto skills = Skills::SkillArray{};
+    for (auto& skill : skills)
+        skill = Skill{40, 40, 40, 0, 0, false, false};
+
+    auto character = Character{
+        0,
+        "Locklear",
+        Skills{skills, 0},
+        Spells{{}},
+        {},
+        {},
+        Conditions{},
+        Inventory{5}};
+
+    for (unsigned i = 0; i < 5; i++)
+        character.GiveItem(items.MakeItem(i * 3));
+    return character;
+}
+
+}
+
+static void BM_DialogSnippets(benchmark::State& state)
+{
+    // Not 18, which has snippets that DialogSnippet patches by offset
+    constexpr std::uint8_t sDialogFile = 0;
+    const auto dialogs = static_cast<unsigned>(state.range(0));
+    auto fb = MakeDialogFile(dialogs);
+
+    // As DialogStore::Load reads each file
+    for (auto _ : state)
+    {
+        fb.Rewind();
+        auto dialogMap = std::unordered_map<KeyTarget, OffsetTarget>{};
+        auto snippetMap = std::unordered_map<OffsetTarget, DialogSnippet>{};
+        const unsigned count = fb.GetUint16LE();
+        for (unsigned i = 0; i < count; i++)
+        {
+            const auto key = KeyTarget{fb.GetUint32LE()};
+            const auto offset = OffsetTarget{sDialogFile, fb.GetUint32LE()};
+            dialogMap.emplace(key, offset);
+        }
+
+        while (fb.GetBytesLeft() > 0)
+        {
+            const auto offset = OffsetTarget{sDialogFile, fb.Tell()};
+            snippetMap.emplace(offset, DialogSnippet{fb, sDialogFile});
+        }
+        benchmark::DoNotOptimize(snippetMap);
+    }
+    state.SetItemsProcessed(state.iterations() * dialogs);
+}
+BENCHMARK(BM_DialogSnippets)->Arg(512);
+
+static void BM_DialogStoreLoad(benchmark::State& state)
+{
+    if (!HaveData(state, "DIAL_Z00.DDX"))
+        return;
+
+    // The store is a singleton, so this can only time the first load
+    for (auto _ : state)
+        benchmark::DoNotOptimize(&DialogStore::Get());
+}
+BENCHMARK(BM_DialogStoreLoad)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+static void BM_SubstituteVariables(benchmark::State& state)
+{
+    auto store = TextVariableStore{};
+    store.SetTextVariable(0, "Locklear");
+    store.SetTextVariable(1, "Owyn");
+    store.SetTextVariable(3, "Gorath");
+    store.SetActiveCharacter("Locklear");
+
+    const auto text = std::string{
+        "@0 looked at @1. \"We should find @3 before nightfall,\" "
+        "said @0. @1 nodded, and the three of them set off along the "
+        "road towards Sethanon, @3 leading the way."};
+    for (auto _ : state)
+        benchmark::DoNotOptimize(store.SubstituteVariables(text));
+}
+BENCHMARK(BM_SubstituteVariables);
+
+static void BM_GameDataLoadSynthetic(benchmark::State& state)
+{
+    AddGameDataDefinitions();
+    const auto path = (std::filesystem::temp_directory_path() / "bakBenchSynthetic.GAM").string();
+    WriteSave(path);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GameData{path});
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_GameDataLoadSynthetic)->Unit(benchmark::kMicrosecond);
+
+static void BM_GameDataSaveSynthetic(benchmark::State& state)
+{
+    AddGameDataDefinitions();
+    const auto savePath = (std::filesystem::temp_directory_path() / "bakBenchSynthetic.GAM").string();
+    WriteSave(savePath);
+
+    auto gameData = GameData{savePath};
+    auto gameState = GameState{&gameData};
+    const auto path = (std::filesystem::temp_directory_path() / "bakBench.GAM").string();
+    for (auto _ : state)
+    {
+        gameState.SaveContainers();
+        gameData.Save("Benchmark", path);
+        SaveWriter::Get().Flush();
+    }
+    std::filesystem::remove(path);
+    std::filesystem::remove(savePath);
+}
+BENCHMARK(BM_GameDataSaveSynthetic)->Unit(benchmark::kMillisecond);
+
+static void BM_GameDataLoad(benchmark::State& state)
+{
+    if (!HaveSave(state, sSave))
+        return;
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GameData{sSave});
+}
+BENCHMARK(BM_GameDataLoad)->Unit(benchmark::kMillisecond);
+
+static void BM_GameDataSave(benchmark::State& state)
+{
+    if (!HaveSave(state, sSave))
+        return;
+
+    auto gameData = GameData{sSave};
+    auto gameState = GameState{&gameData};
+    const auto path = (std::filesystem::temp_directory_path() / "bakBench.GAM").string();
+    for (auto _ : state)
+    {
+        gameState.SaveContainers();
+        gameData.Save("Benchmark", path);
+        SaveWriter::Get().Flush();
+    }
+    std::filesystem::remove(path);
+}
+BENCHMARK(BM_GameDataSave)->Unit(benchmark::kMillisecond);
+
+static void BM_CharacterGetSkill(benchmark::State& state)
+{
+    const auto items = ItemSet{};
+    auto character = MakeCharacter(items);
+    const bool invalidate = state.range(0);
+    for (auto _ : state)
+    {
+        if (invalidate)
+            character.InvalidateSkills();
+        for (unsigned i = 0; i < Skills::sSkills; i++)
+            benchmark::DoNotOptimize(character.GetSkill(static_cast<SkillType>(i)));
+    }
+}
+BENCHMARK(BM_CharacterGetSkill)->ArgName("recalculate")->Arg(0)->Arg(1);
+
+static void BM_InventoryAddRemove(benchmark::State& state)
+{
+    const auto items = ItemSet{};
+    for (auto _ : state)
+    {
+        auto inventory = Inventory{ItemSet::sItems};
+        for (unsigned i = 0; i < ItemSet::sItems; i++)
+            inventory.AddItem(items.MakeItem(i));
+        for (unsigned i = 0; i < ItemSet::sItems; i += 2)
+            inventory.RemoveItem(items.MakeItem(i));
+        benchmark::DoNotOptimize(inventory.GetSpaceUsed());
+    }
+}
+BENCHMARK(BM_InventoryAddRemove);
+
+static void BM_InventoryQueries(benchmark::State& state)
+{
+    const auto items = ItemSet{};
+    auto inventory = Inventory{ItemSet::sItems};
+    for (unsigned i = 0; i < ItemSet::sItems; i++)
+        inventory.AddItem(items.MakeItem(i));
+
+    for (auto _ : state)
+    {
+        for (unsigned i = 0; i < ItemSet::sItems; i++)
+        {
+            const auto item = items.MakeItem(i);
+            benchmark::DoNotOptimize(inventory.HaveItem(item));
+            benchmark::DoNotOptimize(inventory.CanAddCharacter(item));
+        }
+        benchmark::DoNotOptimize(inventory.CalculateModifiers());
+    }
+}
+BENCHMARK(BM_InventoryQueries);
+
+}
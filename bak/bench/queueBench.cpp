@@ -0,0 +1,65 @@
+#include "com/spscQueue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace BAK::Bench {
+
+static void BM_SpscQueuePushPop(benchmark::State& state)
+{
+    SpscQueue<std::uint32_t, 32> queue{};
+    std::uint32_t i = 0;
+    for (auto _ : state)
+    {
+        queue.Push(i++);
+        benchmark::DoNotOptimize(queue.Pop());
+    }
+}
+BENCHMARK(BM_SpscQueuePushPop);
+
+// Time from queueing an item to a sleeping consumer thread handling
+// it, the way AudioManager's sound thread is woken
+static void BM_SpscQueueWakeLatency(benchmark::State& state)
+{
+    SpscQueue<std::uint32_t, 32> queue{};
+    std::atomic<unsigned> wakeups{0};
+    std::atomic<unsigned> handled{0};
+    std::atomic<bool> running{true};
+
+    const auto Wake = [&]{
+        wakeups.fetch_add(1);
+        wakeups.notify_one();
+    };
+
+    auto consumer = std::thread{[&]{
+        while (running)
+        {
+            const auto seen = wakeups.load();
+            if (queue.Pop())
+            {
+                handled.fetch_add(1);
+                handled.notify_one();
+                continue;
+            }
+            wakeups.wait(seen);
+        }
+    }};
+
+    unsigned sent = 0;
+    for (auto _ : state)
+    {
+        queue.Push(sent);
+        Wake();
+        handled.wait(sent++);
+    }
+
+    running = false;
+    Wake();
+    consumer.join();
+}
+BENCHMARK(BM_SpscQueueWakeLatency)->UseRealTime();
+
+}
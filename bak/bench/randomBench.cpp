@@ -0,0 +1,29 @@
+#include "com/random.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace BAK::Bench {
+
+// What GetRandomNumber used to do, for comparison
+static void BM_RandomMt19937(benchmark::State& state)
+{
+    static std::mt19937 engine{0};
+    for (auto _ : state)
+    {
+        std::uniform_int_distribution<> dist(0, 99);
+        benchmark::DoNotOptimize(dist(engine));
+    }
+}
+BENCHMARK(BM_RandomMt19937);
+
+static void BM_GetRandomNumber(benchmark::State& state)
+{
+    SetRandomSeed(0);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(GetRandomNumber(0, 99, RandomStream::Skill));
+}
+BENCHMARK(BM_GetRandomNumber)->ThreadRange(1, 4);
+
+}
@@ -0,0 +1,103 @@
+#include "bak/bench/benchData.hpp"
+
+#include "bak/encounter/encounter.hpp"
+#include "bak/model.hpp"
+#include "bak/palette.hpp"
+#include "bak/resourceNames.hpp"
+#include "bak/worldFactory.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+// The model benchmarks need the zone files from the game, there's no
+// reasonable way to synthesise models. Encounters are also loaded from
+// a synthetic tile.
+namespace BAK::Bench {
+
+namespace {
+
+const auto sZone = ZoneLabel{1};
+
+// First tile of the zone that has encounter data
+std::optional<glm::uvec2> FindEncounterTile()
+{
+    for (unsigned x = 0; x < 64; x++)
+        for (unsigned y = 0; y < 64; y++)
+            if (FileBufferFactory::Get().DataBufferExists(sZone.GetTileData(x, y)))
+                return glm::uvec2{x, y};
+    return std::nullopt;
+}
+
+}
+
+static void BM_LoadTBL(benchmark::State& state)
+{
+    if (!HaveData(state, sZone.GetTable()))
+        return;
+
+    auto fb = FileBufferFactory::Get().CreateDataBuffer(sZone.GetTable());
+    std::size_t models = 0;
+    for (auto _ : state)
+    {
+        fb.Rewind();
+        const auto result = LoadTBL(fb);
+        models = result.size();
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * models);
+}
+BENCHMARK(BM_LoadTBL)->Unit(benchmark::kMillisecond);
+
+static void BM_ZoneItemToMeshObject(benchmark::State& state)
+{
+    if (!HaveData(state, sZone.GetTable()) || !HaveData(state, sZone.GetPalette()))
+        return;
+
+    const auto palette = Palette{sZone.GetPalette()};
+    const auto textures = ZoneTextureStore{sZone, palette};
+    const auto items = ZoneItemStore{sZone, textures};
+    for (auto _ : state)
+    {
+        for (const auto& item : items.GetItems())
+            benchmark::DoNotOptimize(ZoneItemToMeshObject(item, textures, palette));
+    }
+    state.SetItemsProcessed(state.iterations() * items.GetItems().size());
+}
+BENCHMARK(BM_ZoneItemToMeshObject)->Unit(benchmark::kMillisecond);
+
+static void BM_EncounterStoreSynthetic(benchmark::State& state)
+{
+    AddEncounterDefinitions();
+    const auto factory = Encounter::EncounterFactory{};
+    const auto tile = glm::uvec2{10, 15};
+    auto fb = MakeEncounterTile();
+    for (auto _ : state)
+    {
+        fb.Rewind();
+        benchmark::DoNotOptimize(Encounter::EncounterStore{factory, fb, tile, 0});
+    }
+}
+BENCHMARK(BM_EncounterStoreSynthetic);
+
+static void BM_EncounterStore(benchmark::State& state)
+{
+    const auto tile = FindEncounterTile();
+    if (!tile)
+    {
+        state.SkipWithError("No encounter data found in the game data directory");
+        return;
+    }
+
+    const auto factory = Encounter::EncounterFactory{};
+    auto fb = FileBufferFactory::Get().CreateDataBuffer(
+        sZone.GetTileData(tile->x, tile->y));
+    for (auto _ : state)
+    {
+        fb.Rewind();
+        benchmark::DoNotOptimize(Encounter::EncounterStore{factory, fb, *tile, 0});
+    }
+}
+BENCHMARK(BM_EncounterStore);
+
+}
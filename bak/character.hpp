@@ -12,6 +12,7 @@
 #include "bak/inventory.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <iterator>
 #include <ostream>
@@ -22,6 +23,19 @@ namespace BAK {
 class Character final : public IContainer
 {
 public:
+    // Effective skill values derived from the true skills, the
+    // inventory modifiers and the conditions. mVersion changes
+    // every time the values are recalculated so observers can
+    // tell whether anything they display is out of date.
+    struct SkillSnapshot
+    {
+        static constexpr auto sEntries = Skills::sSkills + 1; // + TotalHealth
+
+        unsigned mVersion;
+        std::array<unsigned, sEntries> mCurrent;
+        std::array<unsigned, sEntries> mMax;
+    };
+
     Character(
         unsigned index,
         const std::string& name,
@@ -40,12 +54,14 @@ public:
         mUnknown2{unknown2},
         mConditions{conditions},
         mInventory{std::move(inventory)},
+        mSkillSnapshot{},
+        mSkillsDirty{true},
         mLogger{Logging::LogState::GetLogger("BAK::Character")}
     {}
 
     /* IContainer */
 
-    Inventory& GetInventory() override { return mInventory; }
+    Inventory& GetInventory() override { InvalidateSkills(); return mInventory; }
     const Inventory& GetInventory() const override { return mInventory; }
 
     bool CanSwapItem(const InventoryItem& ref) const
@@ -113,6 +129,7 @@ public:
             mConditions.IncreaseCondition(
                 static_cast<Condition>(ref.GetObject().mEffectMask),
                 ref.GetObject().mEffect);
+            InvalidateSkills();
             return true;
         }
 
@@ -120,6 +137,7 @@ public:
             || equipped)
         {
             mInventory.AddItem(item);
+            InvalidateSkills();
             return true;
         }
 
@@ -131,6 +149,7 @@ public:
         if (mInventory.HaveItem(item))
         {
             mInventory.RemoveItem(item);
+            InvalidateSkills();
             return true;
         }
 
@@ -145,6 +164,7 @@ public:
     ShopStats& GetShop() override { ASSERT(false); return *reinterpret_cast<ShopStats*>(this);}
     const ShopStats& GetShop() const override { ASSERT(false); return *reinterpret_cast<const ShopStats*>(this);}
     LockStats& GetLock() override { ASSERT(false); return *reinterpret_cast<LockStats*>(this); }
+    const LockStats& GetLock() const override { ASSERT(false); return *reinterpret_cast<const LockStats*>(this); }
     /* Character Getters */
 
     CharIndex GetIndex() const { return mCharacterIndex; }
@@ -209,6 +229,7 @@ public:
 
     void ApplyItemToSlot(InventoryIndex index, ItemType slot)
     {
+        InvalidateSkills();
         auto& item = mInventory.GetAtIndex(index);
         auto equipped = mInventory.FindEquipped(slot);
 
@@ -330,42 +351,38 @@ public:
     void ImproveSkill(SkillType skill, SkillChange skillChangeType, unsigned multiplier)
     {
         mSkills.ImproveSkill(skill, skillChangeType, multiplier);
+        InvalidateSkills();
         UpdateSkills();
     }
 
     unsigned GetSkill(SkillType skill) const
     {
-        if (skill != SkillType::TotalHealth)
-        {
-            mSkills.GetSkill(skill).mModifier = mInventory.CalculateModifiers(skill);
-        }
-        return CalculateEffectiveSkillValue(
-            skill,
-            mSkills,
-            mConditions,
-            SkillRead::Current);
+        return GetSkillSnapshot().mCurrent[static_cast<unsigned>(skill)];
     }
 
     unsigned GetMaxSkill(SkillType skill) const
     {
-        if (skill != SkillType::TotalHealth)
-        {
-            mSkills.GetSkill(skill).mModifier = mInventory.CalculateModifiers(skill);
-        }
-        return CalculateEffectiveSkillValue(
-            skill,
-            mSkills,
-            mConditions,
-            SkillRead::MaxSkill);
+        return GetSkillSnapshot().mMax[static_cast<unsigned>(skill)];
     }
 
+    const SkillSnapshot& GetSkillSnapshot() const
+    {
+        if (mSkillsDirty)
+            RecalculateSkills();
+        return mSkillSnapshot;
+    }
+
+    // Must be called after mutating mSkills, mConditions or
+    // mInventory directly rather than through this class.
+    void InvalidateSkills() { mSkillsDirty = true; }
+
     const Conditions& GetConditions() const { return mConditions; }
-    Conditions& GetConditions() { return mConditions; }
+    Conditions& GetConditions() { InvalidateSkills(); return mConditions; }
 
+    // Brings the mCurrent and mModifier fields of mSkills up to date
     void UpdateSkills()
     {
-        for (unsigned i = 0; i < BAK::Skills::sSkills; i++)
-            GetSkill(static_cast<SkillType>(i));
+        GetSkillSnapshot();
     }
 
     Spells& GetSpells()
@@ -387,6 +404,31 @@ public:
     Conditions mConditions;
     Inventory mInventory;
 
+private:
+    void RecalculateSkills() const
+    {
+        const auto modifiers = mInventory.CalculateModifiers();
+        for (unsigned i = 0; i < Skills::sSkills; i++)
+        {
+            mSkills.GetSkill(static_cast<SkillType>(i)).mModifier = modifiers[i];
+        }
+
+        for (unsigned i = 0; i < SkillSnapshot::sEntries; i++)
+        {
+            const auto skill = static_cast<SkillType>(i);
+            mSkillSnapshot.mCurrent[i] = CalculateEffectiveSkillValue(
+                skill, mSkills, mConditions, SkillRead::Current);
+            mSkillSnapshot.mMax[i] = CalculateEffectiveSkillValue(
+                skill, mSkills, mConditions, SkillRead::MaxSkill);
+        }
+
+        mSkillSnapshot.mVersion++;
+        mSkillsDirty = false;
+    }
+
+    mutable SkillSnapshot mSkillSnapshot;
+    mutable bool mSkillsDirty;
+
     const Logging::Logger& mLogger;
 };
 
@@ -151,30 +151,36 @@ public:
     const ContainerHeader& GetHeader() const { return mHeader; }
 
     bool HasLock() const { return bool{mLock}; }
-    LockStats& GetLock() override { ASSERT(mLock); return *mLock; }
-    const LockStats& GetLock() const { ASSERT(mLock); return *mLock; }
+    LockStats& GetLock() override { ASSERT(mLock); mDirty = true; return *mLock; }
+    const LockStats& GetLock() const override { ASSERT(mLock); return *mLock; }
 
     bool HasDialog() const { return bool{mDialog}; }
     const ContainerDialog& GetDialog() const { ASSERT(mDialog); return *mDialog; }
-    ContainerDialog& GetDialog() { ASSERT(mDialog); return *mDialog; }
+    ContainerDialog& GetDialog() { ASSERT(mDialog); mDirty = true; return *mDialog; }
 
     bool HasShop() const { return bool{mShop}; }
-    ShopStats& GetShop() override { ASSERT(mShop); return *mShop; }
+    ShopStats& GetShop() override { ASSERT(mShop); mDirty = true; return *mShop; }
     const ShopStats& GetShop() const override { ASSERT(mShop); return *mShop; }
 
     bool HasEncounter() const { return bool{mEncounter}; }
-    ContainerEncounter& GetEncounter() { ASSERT(mEncounter); return *mEncounter; }
+    ContainerEncounter& GetEncounter() { ASSERT(mEncounter); mDirty = true; return *mEncounter; }
     const ContainerEncounter& GetEncounter() const { ASSERT(mEncounter); return *mEncounter; }
 
     bool HasLastAccessed() const { return bool{mLastAccessed}; }
-    Time& GetLastAccessed() { ASSERT(mLastAccessed); return *mLastAccessed; }
+    Time& GetLastAccessed() { ASSERT(mLastAccessed); mDirty = true; return *mLastAccessed; }
     const Time& GetLastAccessed() const { ASSERT(mLastAccessed); return *mLastAccessed; }
 
     bool HasInventory() const { return bool{mHeader.mCapacity != 0}; }
 
-    Inventory& GetInventory() override { return mInventory; }
+    Inventory& GetInventory() override { mDirty = true; return mInventory; }
     const Inventory& GetInventory() const override { return mInventory; }
 
+    // Set whenever mutable access is handed out, only dirty containers
+    // need to be written back to the save buffer. Read through the const
+    // accessors (std::as_const) so that looking doesn't dirty them.
+    bool IsDirty() const { return mDirty; }
+    void ClearDirty() { mDirty = false; }
+
     bool CanAddItem(const InventoryItem& item) const override
     {
         return mInventory.CanAddContainer(item);
@@ -188,12 +194,14 @@ public:
             mInventory.RemoveItem(BAK::InventoryIndex(mInventory.GetCapacity() - sTypicalShopBuffer));
         }
 
+        mDirty = true;
         mInventory.AddItem(item);
         return true;
     }
 
     bool RemoveItem(const InventoryItem& item) override
     {
+        mDirty = true;
         mInventory.RemoveItem(item);
         return true;
     }
@@ -211,6 +219,7 @@ private:
     std::optional<ContainerEncounter> mEncounter;
     std::optional<Time> mLastAccessed;
     Inventory mInventory;
+    bool mDirty{false};
 };
 
 template <typename HeaderTag>
@@ -0,0 +1,34 @@
+#include "bak/eventFlags.hpp"
+
+#include "com/bits.hpp"
+
+namespace BAK {
+
+void EventFlags::Read(
+    std::span<const unsigned> eventPtrs,
+    std::span<unsigned> states) const
+{
+    ASSERT(states.size() >= eventPtrs.size());
+    for (unsigned i = 0; i < eventPtrs.size(); i++)
+        states[i] = Read(eventPtrs[i]);
+}
+
+bool EventFlags::AnySet(std::span<const unsigned> eventPtrs) const
+{
+    for (const auto eventPtr : eventPtrs)
+        if (ReadBool(eventPtr))
+            return true;
+    return false;
+}
+
+void EventFlags::WriteAt(EventBitLocation location, bool value)
+{
+    const auto data = SetBit(
+        ReadWord(location.mByteOffset),
+        location.mBitOffset,
+        value);
+    mData[location.mByteOffset] = data & 0xff;
+    mData[location.mByteOffset + 1] = (data >> 8) & 0xff;
+}
+
+}
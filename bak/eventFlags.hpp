@@ -0,0 +1,96 @@
+#pragma once
+
+#include "com/assert.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace BAK {
+
+struct EventBitLocation
+{
+    unsigned mByteOffset;
+    unsigned mBitOffset;
+};
+
+// View over the event flag records of a save image. Locations are pure
+// offset arithmetic and reads never touch a FileBuffer cursor, so any
+// number of threads may read concurrently as long as nobody writes.
+class EventFlags
+{
+public:
+    static constexpr auto sEventRecordOffset = 0x6e2; // -> 0xadc
+    static constexpr auto sComplexEventRecordOffset = 0xb09;
+    static constexpr auto sComplexEventThreshold = 0xdac0;
+
+    EventFlags(std::uint8_t* data, unsigned size)
+    :
+        mData{data},
+        mSize{size}
+    {
+        ASSERT(mData);
+    }
+
+    static constexpr EventBitLocation LocateEvent(unsigned eventPtr)
+    {
+        return EventBitLocation{
+            (0xfffe & (eventPtr >> 3)) + sEventRecordOffset,
+            eventPtr & 0xf};
+    }
+
+    static constexpr EventBitLocation LocateComplexEvent(unsigned eventPtr)
+    {
+        const auto source = (eventPtr + 0x2540) & 0xffff;
+        return EventBitLocation{
+            (source / 10) + sComplexEventRecordOffset,
+            source % 10 != 0 ? (source % 10) - 1 : 0};
+    }
+
+    static constexpr EventBitLocation Locate(unsigned eventPtr)
+    {
+        return eventPtr >= sComplexEventThreshold
+            ? LocateComplexEvent(eventPtr)
+            : LocateEvent(eventPtr);
+    }
+
+    // The event word shifted down to the event's bit, complex events
+    // use the higher bits as a small counter
+    unsigned ReadAt(EventBitLocation location) const
+    {
+        return ReadWord(location.mByteOffset) >> location.mBitOffset;
+    }
+
+    unsigned Read(unsigned eventPtr) const { return ReadAt(Locate(eventPtr)); }
+    bool ReadBool(unsigned eventPtr) const { return (Read(eventPtr) & 0x1) == 1; }
+
+    // Batch queries, states must be at least as long as eventPtrs
+    void Read(std::span<const unsigned> eventPtrs, std::span<unsigned> states) const;
+    bool AnySet(std::span<const unsigned> eventPtrs) const;
+
+    void WriteAt(EventBitLocation location, bool value);
+    void Write(unsigned eventPtr, unsigned value) { WriteAt(Locate(eventPtr), value != 0); }
+
+    std::uint8_t ReadByte(unsigned byteOffset) const
+    {
+        ASSERT(byteOffset < mSize);
+        return mData[byteOffset];
+    }
+
+    void WriteByte(unsigned byteOffset, std::uint8_t value)
+    {
+        ASSERT(byteOffset < mSize);
+        mData[byteOffset] = value;
+    }
+
+private:
+    std::uint16_t ReadWord(unsigned byteOffset) const
+    {
+        ASSERT(byteOffset + 1 < mSize);
+        return mData[byteOffset] | (mData[byteOffset + 1] << 8);
+    }
+
+    std::uint8_t* mData;
+    unsigned mSize;
+};
+
+}
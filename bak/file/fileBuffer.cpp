@@ -8,6 +8,7 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <vector>
 
 #include <cassert>
 #include <cstring>
@@ -300,62 +301,54 @@ FileBuffer::SkipBits()
     }
 }
 
-typedef union _HashTableEntry {
-    uint32_t code;
-    struct
-    {
-        uint16_t prefix;
-        uint8_t  append;
-    }
-    entry;
-} HashTableEntry;
-
 unsigned
 FileBuffer::CompressLZW(FileBuffer *result)
 {
     try
     {
+        // Written for DecompressLZW. It adds each table entry a code
+        // later than we do, so the code width follows its entry count.
+        // Once the table is full no more entries are added, so the
+        // reset code is never needed.
+        constexpr unsigned maxEntries = 4096;
         std::map<uint32_t, uint16_t> hashtable;
-        unsigned n_bits = 9;
         unsigned free_entry = 257;
-        unsigned bitpos = 0;
-        HashTableEntry hte;
-        hte.entry.prefix = GetUint8();
-        while (!AtEnd() && !result->AtEnd())
+        unsigned codes = 0;
+        const auto PutCode = [&](unsigned code)
         {
-            hte.entry.append = GetUint8();
-            std::map<uint32_t, uint16_t>::iterator it = hashtable.find(hte.code);
-            if (it == hashtable.end())
+            const auto entries = std::min(257 + (codes > 0 ? codes - 1 : 0), maxEntries);
+            unsigned n_bits = 9;
+            while ((n_bits < 12) && (entries >= (1u << n_bits)))
             {
-                result->PutBits(hte.entry.prefix, n_bits);
-                bitpos += n_bits;
-                hashtable.insert(std::pair<uint32_t, uint16_t>(hte.code, free_entry));
-                hte.entry.prefix = hte.entry.append;
-                free_entry++;
-                if (free_entry >= (unsigned)(1 << n_bits))
-                {
-                    if (n_bits < 12)
-                    {
-                        n_bits++;
-                    }
-                    else
-                    {
-                        hashtable.clear();
-                        free_entry = 256;
-                        result->PutBits(free_entry, n_bits);
-                        result->SkipBits();
-                        result->Skip((((bitpos-1)+((n_bits<<3)-(bitpos-1+(n_bits<<3))%(n_bits<<3)))-bitpos)>>3);
-                        n_bits = 9;
-                        bitpos = 0;
-                    }
-                }
+                n_bits++;
             }
-            else
+            result->PutBits(code, n_bits);
+            codes++;
+        };
+
+        if (!AtEnd())
+        {
+            uint32_t prefix = GetUint8();
+            while (!AtEnd())
             {
-                hte.entry.prefix = it->second;
+                const uint8_t append = GetUint8();
+                const uint32_t key = (prefix << 8) | append;
+                const auto it = hashtable.find(key);
+                if (it != hashtable.end())
+                {
+                    prefix = it->second;
+                    continue;
+                }
+                PutCode(prefix);
+                if (free_entry < maxEntries)
+                {
+                    hashtable.emplace(key, free_entry++);
+                }
+                prefix = append;
             }
+            PutCode(prefix);
+            result->SkipBits();
         }
-        hashtable.clear();
         unsigned res = result->GetBytesDone();
         result->Rewind();
         return res;
@@ -374,54 +367,91 @@ FileBuffer::CompressLZSS(FileBuffer *result)
 {
     try
     {
-        uint8_t *data = GetCurrent();
-        uint8_t *current = GetCurrent();
-        uint8_t *codeptr = result->GetCurrent();
-        uint8_t byte = GetUint8();
-        uint8_t code = 0;
+        // Copies are a 16 bit offset from the start of the output and
+        // a length of 5 to 260. A copy may overlap the bytes it writes.
+        constexpr unsigned minCopy = 5;
+        constexpr unsigned maxCopy = 0xff + minCopy;
+        constexpr unsigned maxOffset = 0xffff;
+        constexpr unsigned maxCandidates = 256;
+        constexpr unsigned hashBits = 16;
+        constexpr unsigned noEntry = std::numeric_limits<unsigned>::max();
+
+        const uint8_t *data = GetCurrent();
+        const unsigned size = GetBytesLeft();
+        // Chains of earlier positions whose first minCopy bytes hash alike
+        std::vector<unsigned> head(1u << hashBits, noEntry);
+        std::vector<unsigned> previous(size, noEntry);
+        const auto Hash = [data](unsigned pos)
+        {
+            uint32_t h = 0;
+            for (unsigned i = 0; i < minCopy; i++)
+            {
+                h = (h << 5) ^ data[pos + i];
+            }
+            return (h * 2654435761u) >> (32 - hashBits);
+        };
+        const auto Insert = [&](unsigned pos)
+        {
+            if ((pos + minCopy <= size) && (pos <= maxOffset))
+            {
+                const auto h = Hash(pos);
+                previous[pos] = head[h];
+                head[h] = pos;
+            }
+        };
+
+        uint8_t *codeptr = nullptr;
         uint8_t mask = 0;
-        while (!AtEnd() && !result->AtEnd())
+        unsigned pos = 0;
+        while (pos < size)
         {
             if (!mask)
             {
-                *codeptr = code;
                 codeptr = result->GetCurrent();
-                result->Skip(1);
-                code = 0;
+                result->PutUint8(0);
                 mask = 0x01;
             }
             unsigned off = 0;
             unsigned len = 0;
-            uint8_t *ptr = current;
-            while (ptr > data)
+            if (pos + minCopy <= size)
             {
-                ptr--;
-                if (*ptr == byte)
+                unsigned candidates = 0;
+                for (auto from = head[Hash(pos)];
+                    (from != noEntry) && (candidates < maxCandidates);
+                    from = previous[from], candidates++)
                 {
-                    off = ptr - data;
-                    len = 1;
-                    while ((current + len < mBuffer + mSize) && (ptr[len] == current[len]))
+                    unsigned n = 0;
+                    while ((pos + n < size) && (n < maxCopy) && (data[from + n] == data[pos + n]))
+                    {
+                        n++;
+                    }
+                    if (n > len)
                     {
-                        len++;
+                        off = from;
+                        len = n;
                     }
                 }
             }
-            if (len < 5)
+            if (len < minCopy)
             {
-                code |= mask;
-                result->PutUint8(byte);
+                *codeptr |= mask;
+                result->PutUint8(data[pos]);
+                Insert(pos);
+                pos++;
             }
             else
             {
                 result->PutUint16LE(off);
-                result->PutUint8(len - 5);
-                Skip(len - 1);
+                result->PutUint8(len - minCopy);
+                for (unsigned i = 0; i < len; i++)
+                {
+                    Insert(pos + i);
+                }
+                pos += len;
             }
-            current = GetCurrent();
-            byte = GetUint8();
             mask <<= 1;
         }
-        *codeptr = code;
+        Skip(size);
         unsigned res = result->GetBytesDone();
         result->Rewind();
         return res;
@@ -658,7 +688,17 @@ FileBuffer::DecompressLZSS(FileBuffer *result)
             {
                 unsigned off = GetUint16LE();
                 unsigned len = GetUint8() + 5;
-                result->PutData(data + off, len);
+                // A copy overlapping the output repeats the bytes it has
+                // just written, so it has to go a byte at a time
+                if (data + off + len > result->GetCurrent())
+                {
+                    for (unsigned i = 0; i < len; i++)
+                        result->PutUint8(data[off + i]);
+                }
+                else
+                {
+                    result->PutData(data + off, len);
+                }
             }
             mask <<= 1;
         }
@@ -764,6 +804,12 @@ FileBuffer::GetCurrent() const
     return mCurrent;
 }
 
+uint8_t *
+FileBuffer::GetBuffer() const
+{
+    return mBuffer;
+}
+
 unsigned
 FileBuffer::GetNextBit() const
 {
@@ -774,6 +820,7 @@ void
 FileBuffer::Rewind()
 {
     mCurrent = mBuffer;
+    mNextBit = 0;
 }
 
 unsigned
@@ -68,6 +68,8 @@ public:
     unsigned GetBytesDone() const;
     unsigned GetBytesLeft() const;
     std::uint8_t * GetCurrent() const;
+    // Start of the underlying storage, independent of the cursor
+    std::uint8_t * GetBuffer() const;
     unsigned GetNextBit() const;
 
     std::uint8_t GetUint8();
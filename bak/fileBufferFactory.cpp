@@ -13,7 +13,8 @@ FileBufferFactory::FileBufferFactory()
 :
     mDataPath{(std::filesystem::path{GetBakDirectory()} / "data").string()},
     mSavePath{(std::filesystem::path{GetBakDirectory()} / "save").string()},
-    mDataFileProvider{{(std::filesystem::path{GetBakDirectory()} / "data").string()}}
+    mDataFileProvider{{(std::filesystem::path{GetBakDirectory()} / "data").string()}},
+    mFallbackDataBuffers{}
 {}
 
 FileBufferFactory& FileBufferFactory::Get()
@@ -39,6 +40,11 @@ FileBuffer FileBufferFactory::CreateDataBuffer(const std::string& fileName)
     {
         return dataBuffer->MakeSubBuffer(0, dataBuffer->GetSize());
     }
+    else if (const auto it = mFallbackDataBuffers.find(fileName);
+        it != mFallbackDataBuffers.end())
+    {
+        return it->second.MakeSubBuffer(0, it->second.GetSize());
+    }
     else
     {
         std::stringstream ss{};
@@ -50,7 +56,13 @@ FileBuffer FileBufferFactory::CreateDataBuffer(const std::string& fileName)
 
 bool FileBufferFactory::DataBufferExists(const std::string& fileName)
 {
-    return mDataFileProvider.GetDataBuffer(fileName) != nullptr;
+    return mDataFileProvider.GetDataBuffer(fileName) != nullptr
+        || mFallbackDataBuffers.contains(fileName);
+}
+
+void FileBufferFactory::AddFallbackDataBuffer(const std::string& fileName, FileBuffer&& fb)
+{
+    mFallbackDataBuffers.try_emplace(fileName, std::move(fb));
 }
 
 bool FileBufferFactory::SaveBufferExists(const std::string& fileName)
@@ -4,6 +4,7 @@
 #include "bak/file/aggregateFileProvider.hpp"
 
 #include <string>
+#include <unordered_map>
 
 namespace BAK {
 
@@ -21,6 +22,11 @@ public:
     FileBuffer CreateSaveBuffer(const std::string& path);
     FileBuffer CreateFileBuffer(const std::string& path);
 
+    // Used when the data directory doesn't have the file, so tests
+    // and benchmarks can provide their own. A file keeps the first
+    // buffer added for it.
+    void AddFallbackDataBuffer(const std::string& path, FileBuffer&&);
+
 private:
     FileBufferFactory();
 
@@ -32,6 +38,7 @@ private:
     std::string mDataPath;
     std::string mSavePath;
     File::AggregateFileProvider mDataFileProvider;
+    std::unordered_map<std::string, FileBuffer> mFallbackDataBuffers;
 };
 
 }
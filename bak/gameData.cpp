@@ -13,6 +13,7 @@ namespace BAK {
 GameData::GameData(const std::string& save)
 :
     mBuffer{FileBufferFactory::Get().CreateSaveBuffer(save)},
+    mEventFlags{mBuffer.GetBuffer(), mBuffer.GetSize()},
     mLogger{Logging::LogState::GetLogger("GameData")},
     mName{LoadSaveName(mBuffer)},
     mObjects{},
@@ -21,86 +22,34 @@ GameData::GameData(const std::string& save)
     mTime{LoadWorldTime()},
     mParty{LoadParty()}
 {
-
-    mLogger.Info() << "Loading save: " << mBuffer.GetString() << std::endl;
-    //mLogger.Info() << mParty << "\n";
+    mLogger.Info() << "Loading save: " << mName << std::endl;
     mLogger.Info() << mTime << std::hex << " " << mTime.mTime.mTime << std::dec << "\n";
-    //LoadContainers(0x1);
-    //LoadContainers(0x2);
-    //LoadContainers(0x3);
-    //LoadContainers(0x4);
-    //LoadContainers(0x5);
-    //LoadContainers(0x6);
-    //LoadContainers(0x7);
-    //LoadContainers(0x8);
-    //LoadContainers(0x9);
-    //LoadContainers(0xa);
-    //LoadContainers(0xb);
-    //LoadContainers(0xc);
-    //mLogger.Debug() << "Loaded Z12 Cont: " << std::hex 
-    //    << mBuffer.Tell() << std::dec << "\n";
-    LoadShops();
-    LoadCombatEntityLists();
-    LoadCombatStats(0x914b, 1698);
-    LoadCombatGridLocations();
-    LoadCombatWorldLocations();
-}
 
+    // Containers and shops are decoded by GameState when they are
+    // first needed. Nothing reads the combat inventories, they are
+    // left as they are in the save buffer.
+}
 
 std::pair<unsigned, unsigned> GameData::CalculateComplexEventOffset(unsigned eventPtr) const
 {
-    const auto source = (eventPtr + 0x2540) & 0xffff;
-    const auto byteOffset = source / 10;
-    const auto bitOffset = source % 10 != 0
-        ? (source % 10) - 1
-        : 0;
-        
-    mLogger.Spam() << __FUNCTION__ << std::hex << " " << eventPtr << " ("
-        << byteOffset + sGameComplexEventRecordOffset << ", " 
-        << bitOffset << ")\n" << std::dec;
-    return std::make_pair(
-        byteOffset + sGameComplexEventRecordOffset,
-        bitOffset);
+    const auto location = EventFlags::LocateComplexEvent(eventPtr);
+    return std::make_pair(location.mByteOffset, location.mBitOffset);
 }
 
 std::pair<unsigned, unsigned> GameData::CalculateEventOffset(unsigned eventPtr) const
 {
-    const unsigned startOffset = sGameEventRecordOffset;
-    const unsigned bitOffset = eventPtr & 0xf;
-    const unsigned byteOffset = (0xfffe & (eventPtr >> 3)) + startOffset;
-    mLogger.Spam() << __FUNCTION__ << std::hex << " " << eventPtr << " ("
-        << byteOffset << ", " << bitOffset << ")\n" << std::dec;
-    return std::make_pair(byteOffset, bitOffset);
+    const auto location = EventFlags::LocateEvent(eventPtr);
+    return std::make_pair(location.mByteOffset, location.mBitOffset);
 }
 
 void GameData::SetBitValueAt(unsigned byteOffset, unsigned bitOffset, unsigned value)
 {
-    mBuffer.Seek(byteOffset);
-    const auto originalData = mBuffer.GetUint16LE();
-    const auto data = SetBit(originalData, bitOffset, value != 0);
-
-    mBuffer.Seek(byteOffset);
-    mBuffer.PutUint16LE(data);
-
-    mLogger.Spam() << __FUNCTION__ << std::hex << 
-        " " << byteOffset << " " << bitOffset 
-        << " original[" << +originalData << "] new[" << +data  <<"]\n" << std::dec;
+    mEventFlags.WriteAt(EventBitLocation{byteOffset, bitOffset}, value != 0);
 }
 
 void GameData::SetEventFlag(unsigned eventPtr, unsigned value)
 {
-    mLogger.Spam() << __FUNCTION__ << " " << std::hex << eventPtr 
-        << " to: " << value << std::dec << "\n";
-    if (eventPtr >= 0xdac0)
-    {
-        const auto [byteOffset, bitOffset] = CalculateComplexEventOffset(eventPtr);
-        SetBitValueAt(byteOffset, bitOffset, value);
-    }
-    else
-    {
-        const auto [byteOffset, bitOffset] = CalculateEventOffset(eventPtr);
-        SetBitValueAt(byteOffset, bitOffset, value);
-    }
+    mEventFlags.Write(eventPtr, value);
 }
 
 void GameData::SetEventFlagTrue (unsigned eventPtr)
@@ -115,21 +64,19 @@ void GameData::SetEventFlagFalse(unsigned eventPtr)
 
 void GameData::SetEventDialogAction(const SetFlag& setFlag)
 {
-    if (setFlag.mEventPointer >= 0xdac0
+    if (setFlag.mEventPointer >= EventFlags::sComplexEventThreshold
         && setFlag.mEventPointer % 10 == 0)
     {
-        const auto offset = std::get<0>(CalculateComplexEventOffset(setFlag.mEventPointer));
-        mBuffer.Seek(offset);
-        const auto data = mBuffer.GetUint8();
+        const auto offset = EventFlags::LocateComplexEvent(setFlag.mEventPointer).mByteOffset;
+        const auto data = mEventFlags.ReadByte(offset);
         const auto newData = ((data & setFlag.mEventMask) 
             | setFlag.mEventData)
             ^ setFlag.mAlwaysZero;
-        mBuffer.Seek(offset);
 
         mLogger.Spam() << __FUNCTION__ << std::hex << 
             " " << setFlag << " offset: " << offset 
             << " data[" << +data << "] new[" << +newData <<"]\n" << std::dec;
-        mBuffer.PutUint8(newData);
+        mEventFlags.WriteByte(offset, newData);
     }
     else
     {
@@ -147,32 +94,17 @@ void GameData::SetEventDialogAction(const SetFlag& setFlag)
 
 unsigned GameData::ReadBitValueAt(unsigned byteOffset, unsigned bitOffset) const
 {
-    mBuffer.Seek(byteOffset);
-    const unsigned eventData = mBuffer.GetUint16LE();
-    const unsigned bitValue = eventData >> bitOffset;
-    mLogger.Spam() << __FUNCTION__ << std::hex << 
-        " " << byteOffset << " " << bitOffset 
-        << " [" << +bitValue << "]\n" << std::dec;
-    return bitValue;
+    return mEventFlags.ReadAt(EventBitLocation{byteOffset, bitOffset});
 }
 
 unsigned GameData::ReadEvent(unsigned eventPtr) const
 {
-    if (eventPtr >= 0xdac0)
-    {
-        const auto [byteOffset, bitOffset] = CalculateComplexEventOffset(eventPtr);
-        return ReadBitValueAt(byteOffset, bitOffset);
-    }
-    else
-    {
-        const auto [byteOffset, bitOffset] = CalculateEventOffset(eventPtr);
-        return ReadBitValueAt(byteOffset, bitOffset);
-    }
+    return mEventFlags.Read(eventPtr);
 }
 
 bool GameData::ReadEventBool(unsigned eventPtr) const
 {
-    return (ReadEvent(eventPtr) & 0x1) == 1;
+    return mEventFlags.ReadBool(eventPtr);
 }
 
 bool GameData::ReadSkillSelected(unsigned character, unsigned skill) const
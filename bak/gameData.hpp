@@ -8,10 +8,13 @@
 #include "bak/container.hpp"
 #include "bak/dialogAction.hpp"
 #include "bak/encounter/encounter.hpp"
+#include "bak/eventFlags.hpp"
 #include "bak/money.hpp"
 #include "bak/party.hpp"
 #include "bak/resourceNames.hpp"
 #include "bak/saveManager.hpp"
+#include "bak/saveSnapshot.hpp"
+#include "bak/saveWriter.hpp"
 #include "bak/skills.hpp"
 #include "bak/types.hpp"
 #include "bak/worldClock.hpp"
@@ -32,6 +35,16 @@ struct Location
     GamePositionAndHeading mLocation;
 };
 
+// In-memory save state that can be restored without touching disk
+struct GameSnapshot
+{
+    std::string mLabel;
+    SavePages mPages;
+    Chapter mChapter;
+    Location mLocation;
+    WorldClock mTime;
+};
+
 class GameData
 {   
 public:
@@ -79,8 +92,8 @@ public:
     static constexpr auto sTimeExpiringEventRecordOffset = 0x618; // (0x4340)
     // Single bit indicators for event state tracking 
     // In the code this offset is 0x440a in the game -> diff of 0x3d28
-    static constexpr auto sGameEventRecordOffset = 0x6e2; // -> 0xadc
-    static constexpr auto sGameComplexEventRecordOffset = 0xb09;
+    static constexpr auto sGameEventRecordOffset = EventFlags::sEventRecordOffset; // -> 0xadc
+    static constexpr auto sGameComplexEventRecordOffset = EventFlags::sComplexEventRecordOffset;
 
     static constexpr auto sConversationChoiceMarkedFlag = 0x1d4c;
     static constexpr auto sConversationOptionInhibitedFlag = 0x1a2c;
@@ -137,38 +150,72 @@ public:
 
     GameData(const std::string& save);
 
-    void Save(const SaveFile& saveFile)
+    void Save(const SaveFile& saveFile, SaveWriter::Callback&& onComplete = {})
     {
-        Save(saveFile.mName, saveFile.mPath);
+        Save(saveFile.mName, saveFile.mPath, std::move(onComplete));
     }
 
+    // Encodes into the save buffer on the calling thread, then hands a
+    // snapshot of it to the SaveWriter so the disk write never stalls a frame
     void Save(
         const std::string& saveName,
-        const std::string& savePath)
+        const std::string& savePath,
+        SaveWriter::Callback&& onComplete = {})
     {
         ASSERT(saveName.size() < 30);
         mBuffer.Seek(0);
         mBuffer.PutString(saveName);
 
-        // Location
-        mBuffer.Seek(sLocationOffset);
-        mBuffer.PutUint8(mLocation.mZone);
-        mBuffer.PutUint8(mLocation.mTile.x);
-        mBuffer.PutUint8(mLocation.mTile.y);
-        mBuffer.PutUint32LE(mLocation.mLocation.mPosition.x);
-        mBuffer.PutUint32LE(mLocation.mLocation.mPosition.y);
-        mBuffer.Skip(5);
-        mBuffer.PutUint16LE(mLocation.mLocation.mHeading);
+        SaveLocation();
+
+        mBuffer.Seek(0);
+        const auto* data = mBuffer.GetCurrent();
+        auto bytes = std::vector<std::uint8_t>{data, data + mBuffer.GetSize()};
+        SaveWriter::Get().Submit(savePath, std::move(bytes), std::move(onComplete));
+    }
 
+    // Captures the save buffer, sharing pages with the previous snapshot
+    // where nothing changed. Party and containers must already have been
+    // written into the buffer.
+    GameSnapshot TakeSnapshot(std::string label, const GameSnapshot* previous)
+    {
+        SaveLocation();
+        return GameSnapshot{
+            std::move(label),
+            SavePages::Capture(mBuffer, previous ? &previous->mPages : nullptr),
+            mChapter,
+            mLocation,
+            mTime};
+    }
 
-        mLogger.Info() << "Saving game to: " << savePath << std::endl;
-        auto saveFile = std::ofstream{
-            savePath,
-            std::ios::binary | std::ios::out};
-        mBuffer.Save(saveFile);
+    // Restores from memory, only the party is decoded again
+    void RestoreSnapshot(const GameSnapshot& snapshot)
+    {
+        mLogger.Info() << "Restoring snapshot: " << snapshot.mLabel << std::endl;
+        snapshot.mPages.Restore(mBuffer);
+        mChapter = snapshot.mChapter;
+        mLocation = snapshot.mLocation;
+        mTime = snapshot.mTime;
+        mParty = LoadParty();
+    }
+
+    // FNV-1a hash of the save buffer. Party and containers must already
+    // have been written into the buffer.
+    std::uint64_t Hash()
+    {
+        SaveLocation();
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        const auto* data = mBuffer.GetBuffer();
+        for (unsigned i = 0; i < mBuffer.GetSize(); i++)
+        {
+            hash ^= data[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
     }
 
     FileBuffer& GetFileBuffer() { return mBuffer; }
+    const EventFlags& GetEventFlags() const { return mEventFlags; }
 
     std::pair<unsigned, unsigned> CalculateComplexEventOffset(unsigned eventPtr) const;
     std::pair<unsigned, unsigned> CalculateEventOffset(unsigned eventPtr) const;
@@ -279,6 +326,18 @@ public:
     static constexpr unsigned GetCharacterInventoryOffset(unsigned c) { return c * sCharacterInventoryLength + sCharacterInventoryOffset; }
     static constexpr unsigned GetCharacterConditionOffset(unsigned c) { return c * Conditions::sNumConditions + sCharacterStatusOffset; }
 
+    void SaveLocation()
+    {
+        mBuffer.Seek(sLocationOffset);
+        mBuffer.PutUint8(mLocation.mZone);
+        mBuffer.PutUint8(mLocation.mTile.x);
+        mBuffer.PutUint8(mLocation.mTile.y);
+        mBuffer.PutUint32LE(mLocation.mLocation.mPosition.x);
+        mBuffer.PutUint32LE(mLocation.mLocation.mPosition.y);
+        mBuffer.Skip(5);
+        mBuffer.PutUint16LE(mLocation.mLocation.mHeading);
+    }
+
     Party LoadParty();
     std::vector<Character> LoadCharacters();
     Conditions LoadConditions(unsigned character);
@@ -305,6 +364,7 @@ public:
     void LoadCombatStats(unsigned offset, unsigned num);
 
     mutable FileBuffer mBuffer;
+    EventFlags mEventFlags;
     Logging::Logger mLogger;
 
     const std::string mName;
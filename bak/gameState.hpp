@@ -5,6 +5,7 @@
 #include "bak/dialogAction.hpp"
 #include "bak/dialogChoice.hpp"
 #include "bak/gameData.hpp"
+#include "bak/IGameStateListener.hpp"
 #include "bak/money.hpp"
 #include "bak/save.hpp"
 #include "bak/textVariableStore.hpp"
@@ -13,11 +14,17 @@
 #include "com/random.hpp"
 #include "com/visit.hpp"
 
+#include <algorithm>
+#include <array>
+#include <optional>
+
 namespace BAK {
 
 class GameState
 {
 public:
+    static constexpr unsigned sMaxSnapshots = 8;
+
     GameState()
     :
         GameState{nullptr}
@@ -53,8 +60,9 @@ public:
         mEndOfDialogState{0},
         mContainers{},
         mGDSContainers{},
-        mCombatContainers{},
         mTextVariableStore{},
+        mSnapshots{sMaxSnapshots},
+        mListeners{},
         mLogger{Logging::LogState::GetLogger("BAK::GameState")}
     {
         if (mGameData != nullptr)
@@ -67,16 +75,37 @@ public:
     {
         ASSERT(gameData);
         mGameData = gameData;
-        mGDSContainers.clear();
-        mCombatContainers.clear();
-        mContainers.clear();
-        for (unsigned i = 0; i < 12; i++)
-        {
-            mContainers.emplace_back(mGameData->LoadContainers(i + 1));
-        }
-        mGDSContainers = mGameData->LoadShops();
-        mCombatContainers = mGameData->LoadCombatInventories();
+        mSnapshots.Clear();
+        ResetContainers();
         mZone = ZoneNumber{mGameData->mLocation.mZone};
+        NotifyListeners(GameStateChange::All);
+    }
+
+    void AddListener(IGameStateListener* listener)
+    {
+        ASSERT(listener);
+        mListeners.emplace_back(listener);
+    }
+
+    void RemoveListener(IGameStateListener* listener)
+    {
+        std::erase(mListeners, listener);
+    }
+
+    void NotifyListeners(GameStateChange::Mask changes)
+    {
+        if (changes == 0)
+            return;
+        for (auto* listener : mListeners)
+            listener->OnGameStateChanged(changes);
+    }
+
+    // Containers are decoded from the save buffer on first access
+    void ResetContainers()
+    {
+        mGDSContainers.reset();
+        for (auto& zoneContainers : mContainers)
+            zoneContainers.reset();
     }
 
     const Party& GetParty() const
@@ -151,25 +180,44 @@ public:
 
     void SetLocation(BAK::Location loc)
     {
+        auto changes = GetLocationChanges(loc.mLocation);
+        if (GetZone().mValue != loc.mZone)
+            changes |= GameStateChange::Zone;
+
         mZone = ZoneNumber{loc.mZone};
         if (mGameData)
         {
             mGameData->mLocation = loc;
         }
+        NotifyListeners(changes);
     }
 
     void SetLocation(BAK::GamePositionAndHeading posAndHeading)
     {
         if (mGameData)
         {
+            const auto changes = GetLocationChanges(posAndHeading);
             const auto loc = Location{
                 mZone.mValue,
                 GetTile(posAndHeading.mPosition),
                 posAndHeading};
             mGameData->mLocation = loc;
+            NotifyListeners(changes);
         }
     }
 
+    GameStateChange::Mask GetLocationChanges(
+        BAK::GamePositionAndHeading posAndHeading) const
+    {
+        const auto current = GetLocation();
+        GameStateChange::Mask changes = 0;
+        if (current.mPosition != posAndHeading.mPosition)
+            changes |= GameStateChange::Position;
+        if (current.mHeading != posAndHeading.mHeading)
+            changes |= GameStateChange::Heading;
+        return changes;
+    }
+
     BAK::GamePositionAndHeading GetLocation() const
     {
         if (mGameData)
@@ -178,7 +226,7 @@ public:
         return BAK::GamePositionAndHeading{ glm::uvec2{10 * 64000, 15 * 64000}, 0 };
     }
 
-    auto GetZone() const
+    ZoneNumber GetZone() const
     {
         if (mGameData)
         {
@@ -227,7 +275,14 @@ public:
 
     IContainer* GetContainerForGDSScene(BAK::HotspotRef ref)
     {
-        for (auto& shop : mGDSContainers)
+        if (!mGDSContainers)
+        {
+            mGDSContainers = mGameData
+                ? mGameData->LoadShops()
+                : std::vector<GenericContainer>{};
+        }
+
+        for (auto& shop : *mGDSContainers)
         {
             if (shop.GetHeader().GetHotspotRef() == ref)
                 return &shop;
@@ -320,7 +375,11 @@ public:
                 }
                 else if (set.mWhat == 0xd || set.mWhat == 0xe)
                 {
-                    const auto character = GetRandomNumber(1, GetParty().GetNumCharacters() - 1);
+                    // Someone other than the leader, unless they are alone
+                    const auto numCharacters = GetParty().GetNumCharacters();
+                    const auto character = numCharacters > 1
+                        ? GetRandomNumber(1, numCharacters - 1, RandomStream::Dialog)
+                        : 0;
                     mTextVariableStore.SetTextVariable(set.mWhich, GetParty().GetCharacter(ActiveCharIndex{character}).GetName());
                 }
                 else if (set.mWhat == 0xb)
@@ -527,6 +586,7 @@ public:
             }
             return false;
         });
+        NotifyListeners(GameStateChange::Time | GameStateChange::Party);
     }
 
     bool EvaluateComplexChoice(const ComplexEventChoice& choice) const
@@ -627,6 +687,23 @@ public:
         return (GetEventState(eventPtr) & 0x1) == 1;
     }
 
+    // Reads every event in one pass, e.g. all the choices of a snippet
+    void GetEventStates(
+        std::span<const unsigned> eventPtrs,
+        std::span<unsigned> states) const
+    {
+        ASSERT(states.size() >= eventPtrs.size());
+        if (mGameData != nullptr)
+            mGameData->GetEventFlags().Read(eventPtrs, states);
+        else
+            std::fill(states.begin(), states.end(), 0);
+
+        // As in GetEventState the chapter isn't an event flag
+        for (unsigned i = 0; i < eventPtrs.size(); i++)
+            if (eventPtrs[i] == static_cast<unsigned>(ActiveStateFlag::Chapter))
+                states[i] = GetChapter().mValue;
+    }
+
     bool CheckInhibited(const ConversationChoice& choice)
     {
         if (mGameData != nullptr)
@@ -754,54 +831,121 @@ public:
         }
     }
 
-    bool Save(const SaveFile& saveFile)
+    // Returns once the save is queued, onComplete fires from
+    // SaveWriter::PollCompleted when the file is on disk
+    bool Save(const SaveFile& saveFile, SaveWriter::Callback&& onComplete = {})
     {
         if (mGameData)
         {
-            BAK::Save(GetParty(), mGameData->GetFileBuffer());
-
-            for (const auto& container : mGDSContainers)
-                BAK::Save(container, mGameData->GetFileBuffer());
-
-            for (const auto& container : mCombatContainers)
-                BAK::Save(container, mGameData->GetFileBuffer());
-
-            for (const auto& zoneContainers : mContainers)
-                for (const auto& container : zoneContainers)
-                    BAK::Save(container, mGameData->GetFileBuffer());
-
-            mGameData->Save(saveFile);
+            SaveContainers();
+            mGameData->Save(saveFile, std::move(onComplete));
             return true;
         }
         return false;
     }
 
-    bool Save(const std::string& saveName)
+    bool Save(const std::string& saveName, SaveWriter::Callback&& onComplete = {})
     {
         if (mGameData)
         {
-            BAK::Save(GetParty(), mGameData->GetFileBuffer());
+            SaveContainers();
+            mGameData->Save(saveName, saveName, std::move(onComplete));
+            return true;
+        }
+        return false;
+    }
 
-            for (const auto& container : mGDSContainers)
-                BAK::Save(container, mGameData->GetFileBuffer());
+    bool TakeSnapshot(std::string label)
+    {
+        if (!mGameData)
+            return false;
 
-            for (const auto& container : mCombatContainers)
-                BAK::Save(container, mGameData->GetFileBuffer());
+        SaveContainers();
+        auto snapshot = mGameData->TakeSnapshot(
+            std::move(label),
+            mSnapshots.GetLatest());
+        if (const auto* previous = mSnapshots.GetLatest())
+        {
+            mLogger.Debug() << "Snapshot shares "
+                << snapshot.mPages.CountSharedPages(previous->mPages)
+                << " of " << snapshot.mPages.GetPageCount() << " pages\n";
+        }
+        mSnapshots.Push(std::move(snapshot));
+        return true;
+    }
 
-            for (const auto& zoneContainers : mContainers)
-                for (const auto& container : zoneContainers)
-                    BAK::Save(container, mGameData->GetFileBuffer());
+    // Age 0 is the most recent snapshot. References to party members
+    // and containers are invalidated.
+    bool RestoreSnapshot(unsigned age)
+    {
+        const auto* snapshot = mSnapshots.Get(age);
+        if (!mGameData || !snapshot)
+            return false;
 
-            mGameData->Save(saveName, saveName);
-            return true;
+        mGameData->RestoreSnapshot(*snapshot);
+        ResetContainers();
+        mZone = ZoneNumber{mGameData->mLocation.mZone};
+        NotifyListeners(GameStateChange::All);
+        return true;
+    }
+
+    const SnapshotRing<GameSnapshot>& GetSnapshots() const { return mSnapshots; }
+
+    // Identifies the game state, two runs that end with the same hash
+    // ended in the same state
+    std::uint64_t Hash()
+    {
+        if (mGameData)
+        {
+            SaveContainers();
+            return mGameData->Hash();
         }
-        return false;
+
+        const auto location = GetLocation();
+        return (static_cast<std::uint64_t>(mZone.mValue) << 56)
+            ^ (static_cast<std::uint64_t>(location.mPosition.x) << 24)
+            ^ location.mPosition.y
+            ^ (static_cast<std::uint64_t>(location.mHeading) << 40);
+    }
+
+    // Containers that were never decoded or never handed out mutably
+    // are unchanged in the save buffer
+    void SaveContainers()
+    {
+        ASSERT(mGameData);
+        // The party isn't dirty tracked, its characters and inventories
+        // are only a few KB and are re-encoded in full on every save.
+        // Event flags need no encoding, they are set directly in the
+        // save buffer.
+        BAK::Save(GetParty(), mGameData->GetFileBuffer());
+
+        const auto saveIfDirty = [&](GenericContainer& container){
+            if (!container.IsDirty()) return;
+            BAK::Save(container, mGameData->GetFileBuffer());
+            container.ClearDirty();
+        };
+
+        if (mGDSContainers)
+            for (auto& container : *mGDSContainers)
+                saveIfDirty(container);
+
+        for (auto& zoneContainers : mContainers)
+            if (zoneContainers)
+                for (auto& container : *zoneContainers)
+                    saveIfDirty(container);
     }
 
     std::vector<GenericContainer>& GetContainers(ZoneNumber zone)
     {
-        ASSERT(zone.mValue < 13);
-        return mContainers[zone.mValue - 1];
+        ASSERT(zone.mValue > 0 && zone.mValue < 13);
+        auto& zoneContainers = mContainers[zone.mValue - 1];
+        if (!zoneContainers)
+        {
+            zoneContainers = mGameData
+                ? mGameData->LoadContainers(zone.mValue)
+                : std::vector<GenericContainer>{};
+        }
+        return *zoneContainers;
     }
 
     bool CheckCustomStateScenarioPlagued() const
@@ -853,11 +997,12 @@ public:
     Chapter mChapter;
     ZoneNumber mZone;
     std::int16_t mEndOfDialogState;
-    std::vector<
-        std::vector<GenericContainer>> mContainers;
-    std::vector<GenericContainer> mGDSContainers;
-    std::vector<GenericContainer> mCombatContainers;
+    std::array<
+        std::optional<std::vector<GenericContainer>>, 12> mContainers;
+    std::optional<std::vector<GenericContainer>> mGDSContainers;
     TextVariableStore mTextVariableStore;
+    SnapshotRing<GameSnapshot> mSnapshots;
+    std::vector<IGameStateListener*> mListeners;
     const Logging::Logger& mLogger;
 };
 
@@ -9,7 +9,7 @@ int HaggleRollRandomNumber(int skillValue)
     int maxRoll = 0;
     for (unsigned i = 0; i < 3; i++)
     {
-        const auto roll = static_cast<int>(GetRandomNumber(0, 0xfff) % skillValue);
+        const auto roll = static_cast<int>(GetRandomNumber(0, 0xfff, RandomStream::Haggle) % skillValue);
         if (roll > maxRoll)
         {
             maxRoll = roll;
@@ -20,7 +20,7 @@ int HaggleRollRandomNumber(int skillValue)
 
 std::optional<unsigned> DoFailHaggle(Party& party, const ShopStats& shop, int randomSkillFactor)
 {
-    const int skillImprovedTest = GetRandomNumber(0, 0xfff) % 100;
+    const int skillImprovedTest = GetRandomNumber(0, 0xfff, RandomStream::Haggle) % 100;
     // the higher the skill, the less likely we train it
     const auto skillTrainThreshold = (100 - randomSkillFactor) / 5;
     if (skillImprovedTest < skillTrainThreshold)
@@ -28,7 +28,7 @@ std::optional<unsigned> DoFailHaggle(Party& party, const ShopStats& shop, int ra
         party.ImproveSkillForAll(SkillType::Haggling, SkillChange::ExercisedSkill, 1);
     }
 
-    const auto shopAnnoyedTest = GetRandomNumber(0, 0xfff) % 100;
+    const auto shopAnnoyedTest = GetRandomNumber(0, 0xfff, RandomStream::Haggle) % 100;
     if (shopAnnoyedTest < shop.mHaggleAnnoyanceFactor)
     {
         return std::make_optional(sUnpurchaseablePrice.mValue);
@@ -49,7 +49,7 @@ std::pair<unsigned, unsigned> GetHaggleWinMargin(unsigned characterSkillValue, u
 std::optional<unsigned> TryHaggle(
     Party& party,
     ActiveCharIndex character,
-    ShopStats& shop,
+    const ShopStats& shop,
     ItemIndex item,
     int shopCurrentDiscount)
 {
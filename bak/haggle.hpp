@@ -14,7 +14,7 @@ namespace BAK::Haggle {
 std::optional<unsigned> TryHaggle(
     Party& party,
     ActiveCharIndex character,
-    ShopStats& shop,
+    const ShopStats& shop,
     ItemIndex item,
     int shopCurrentValue);
 
@@ -182,6 +182,23 @@ public:
         }
         return mods;
     }
+
+    // Accumulates the modifiers of every skill in a single pass
+    std::array<unsigned, Skills::sSkills> CalculateModifiers() const
+    {
+        std::array<unsigned, Skills::sSkills> mods{};
+        for (const auto& item : mItems)
+        {
+            const auto& object = item.GetObject();
+            if (object.mModifierMask == 0) continue;
+            for (unsigned i = 0; i < Skills::sSkills; i++)
+            {
+                if ((object.mModifierMask & (1 << i)) != 0)
+                    mods[i] += object.mModifier;
+            }
+        }
+        return mods;
+    }
     
 private:
     // result > 0 if can add item to inventory.
@@ -104,7 +104,7 @@ unsigned DescribeLock(unsigned picklockSkill, unsigned lockRating)
 
 unsigned GetRandomMod100()
 {
-    return (GetRandom() & 0xfff) % 100;
+    return (GetRandom(RandomStream::Skill) & 0xfff) % 100;
 }
 
 bool KeyBroken(const InventoryItem& item, unsigned skill, unsigned lockRating)
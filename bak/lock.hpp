@@ -17,12 +17,12 @@ struct LockStats
     unsigned mFairyChestIndex;
     unsigned mTrapDamage;
 
-    bool IsFairyChest()
+    bool IsFairyChest() const
     {
         return mFairyChestIndex != 0;
     }
 
-    bool IsTrapped()
+    bool IsTrapped() const
     {
         return mLockFlag == 1 || mLockFlag == 4;
     }
@@ -2,6 +2,8 @@
 
 #include "bak/types.hpp"
 
+#include "com/nameTable.hpp"
+
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -24,6 +26,7 @@ public:
             std::uint8_t colorSwap)
         :
             mPrefix{prefix},
+            mAnimationHandle{InternName(mPrefix)},
             mUnknown0{unknown0},
             mUnknown1{unknown1},
             mUnknown2{unknown2},
@@ -31,6 +34,7 @@ public:
         {}
 
         std::string mPrefix;
+        NameHandle mAnimationHandle;
         std::uint8_t mUnknown0;
         std::uint8_t mUnknown1;
         std::uint8_t mUnknown2;
@@ -55,6 +59,12 @@ public:
         return mMonsterPrefixes[monster.mValue].mPrefix;
     }
 
+    NameHandle GetMonsterAnimationHandle(MonsterIndex monster) const
+    {
+        ASSERT(monster.mValue < mMonsterPrefixes.size());
+        return mMonsterPrefixes[monster.mValue].mAnimationHandle;
+    }
+
     auto GetColorSwap(MonsterIndex monster) const
     {
         ASSERT(monster.mValue < mMonsterPrefixes.size());
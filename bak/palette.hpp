@@ -27,6 +27,11 @@ class Palette
 public:
     Palette(const std::string& filename);
 
+    explicit Palette(std::vector<glm::vec4> colors)
+    :
+        mColors{std::move(colors)}
+    {}
+
     Palette(const Palette& pal, const ColorSwap& cs)
     :
         mColors{std::invoke([&](){
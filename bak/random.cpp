@@ -4,9 +4,9 @@
 
 namespace BAK {
 
-unsigned GetRandom()
+unsigned GetRandom(RandomStream stream)
 {
-    return GetRandomNumber(0, 0xffff);
+    return GetRandom32(stream) & 0xffff;
 }
 
 }
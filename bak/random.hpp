@@ -1,7 +1,10 @@
 #pragma once
 
+#include "com/random.hpp"
+
 namespace BAK {
 
-unsigned GetRandom();
+// Uniform in [0, 0xffff] like the original game's generator
+unsigned GetRandom(RandomStream stream = RandomStream::General);
 
 }
@@ -2,8 +2,37 @@
 
 #include "bak/file/util.hpp"
 
+#include <array>
+#include <fstream>
+
 namespace BAK {
 
+namespace {
+
+static constexpr auto sSaveNameLength = 30;
+
+const std::regex& SaveFileRegex()
+{
+    static const auto saveSuffix = std::regex{"[Ss][Aa][Vv][Ee]([0-9]{2}).[Gg][Aa][mM]$"};
+    return saveSuffix;
+}
+
+const std::regex& SaveDirectoryRegex()
+{
+    static const auto dirSuffix = std::regex{".[Gg]([0-9]{2})$"};
+    return dirSuffix;
+}
+
+std::int64_t GetModifiedTime(const std::filesystem::directory_entry& entry)
+{
+    std::error_code ec{};
+    const auto time = entry.last_write_time(ec);
+    if (ec) return 0;
+    return static_cast<std::int64_t>(time.time_since_epoch().count());
+}
+
+}
+
 unsigned convertToInt(const std::string& s)
 {
     std::stringstream ss{};
@@ -16,7 +45,138 @@ unsigned convertToInt(const std::string& s)
 std::string LoadSaveName(FileBuffer& fb)
 {
     fb.Seek(0);
-    return fb.GetString(30);
+    return fb.GetString(sSaveNameLength);
+}
+
+std::string LoadSaveName(const std::filesystem::path& savePath)
+{
+    std::ifstream in{savePath, std::ios::in | std::ios::binary};
+    auto name = std::array<char, sSaveNameLength + 1>{};
+    in.read(name.data(), sSaveNameLength);
+    return std::string{name.data()};
+}
+
+SaveIndex::SaveIndex(std::filesystem::path saveDir)
+:
+    mIndexPath{saveDir / sIndexFile},
+    mEntries{}
+{
+    std::ifstream in{mIndexPath};
+    // One entry per line: file, size, modified time, save name
+    std::string line{};
+    while (std::getline(in, line))
+    {
+        std::stringstream ss{line};
+        auto entry = Entry{};
+        if (std::getline(ss, entry.mFile, '\t')
+            && (ss >> entry.mSize >> entry.mModified)
+            && ss.get() == '\t')
+        {
+            std::getline(ss, entry.mName);
+            mEntries.emplace_back(std::move(entry));
+        }
+    }
+}
+
+const SaveIndex::Entry* SaveIndex::Find(
+    const std::string& file,
+    std::uintmax_t size,
+    std::int64_t modified) const
+{
+    const auto it = std::find_if(mEntries.begin(), mEntries.end(),
+        [&](const auto& entry){
+            return entry.mFile == file
+                && entry.mSize == size
+                && entry.mModified == modified;
+        });
+    return it != mEntries.end() ? &(*it) : nullptr;
+}
+
+std::size_t SaveIndex::GetEntryCount() const
+{
+    return mEntries.size();
+}
+
+void SaveIndex::Write(const std::vector<Entry>& entries) const
+{
+    std::ofstream out{mIndexPath, std::ios::out | std::ios::trunc};
+    for (const auto& entry : entries)
+    {
+        out << entry.mFile << '\t' << entry.mSize << ' '
+            << entry.mModified << '\t' << entry.mName << '\n';
+    }
+}
+
+// Called from the refresh worker, so this must not log
+std::vector<SaveFile> SaveManager::MakeSaveFiles(std::filesystem::path saveDir)
+{
+    const auto saveIndex = SaveIndex{saveDir};
+    auto indexEntries = std::vector<SaveIndex::Entry>{};
+    bool indexStale = false;
+
+    std::vector<SaveFile> saveFiles{};
+    for (const auto& save : std::filesystem::directory_iterator{saveDir})
+    {
+        const auto saveName = save.path().filename().string();
+        std::smatch matches{};
+        if (!std::regex_search(saveName, matches, SaveFileRegex()))
+            continue;
+
+        std::error_code ec{};
+        const auto size = save.file_size(ec);
+        const auto modified = GetModifiedTime(save);
+        const auto* entry = saveIndex.Find(saveName, size, modified);
+        indexStale |= entry == nullptr;
+
+        auto& indexEntry = indexEntries.emplace_back(
+            SaveIndex::Entry{
+                saveName,
+                size,
+                modified,
+                entry ? entry->mName : LoadSaveName(save.path())});
+
+        saveFiles.emplace_back(
+            SaveFile{
+                convertToInt(matches.str(1)),
+                indexEntry.mName,
+                save.path().string()});
+    }
+
+    // Also rewrite the index when save files have been removed
+    if (indexStale || indexEntries.size() != saveIndex.GetEntryCount())
+    {
+        saveIndex.Write(indexEntries);
+    }
+
+    std::sort(
+        saveFiles.begin(), saveFiles.end(),
+        [](const auto& lhs, const auto& rhs){ return lhs.mIndex < rhs.mIndex; });
+
+    return saveFiles;
+}
+
+template <typename F>
+void SaveManager::ForEachSaveDirectory(F&& onDirectory)
+{
+    const auto saveDirectories = std::filesystem::directory_iterator{
+        GetBakDirectoryPath() / "GAMES"};
+
+    for (const auto& directory : saveDirectories)
+    {
+        if (mCancelRefresh)
+            return;
+
+        const auto dirName = directory.path().filename().string();
+        std::smatch matches{};
+        if (std::regex_search(dirName, matches, SaveDirectoryRegex()))
+        {
+            onDirectory(
+                SaveDirectory{
+                    convertToInt(matches.str(1)),
+                    directory.path().stem().string(),
+                    MakeSaveFiles(directory.path())});
+        }
+    }
 }
 
 SaveManager::SaveManager(
@@ -24,9 +184,21 @@ SaveManager::SaveManager(
 :
     mSavePath{savePath},
     mDirectories{},
+    mRefresh{},
+    mCancelRefresh{false},
+    mPendingMutex{},
+    mPendingDirectories{},
+    mRefreshFinished{false},
+    mRefreshedDirectories{},
     mLogger{Logging::LogState::GetLogger("BAK::SaveManager")}
 {}
 
+SaveManager::~SaveManager()
+{
+    mCancelRefresh = true;
+    WaitForRefresh();
+}
+
 const std::vector<SaveDirectory>& SaveManager::GetSaves() const
 {
     return mDirectories;
@@ -34,11 +206,122 @@ const std::vector<SaveDirectory>& SaveManager::GetSaves() const
 
 void SaveManager::RefreshSaves()
 {
+    WaitForRefresh();
     mDirectories = MakeSaveDirectories();
 }
 
+void SaveManager::RefreshSavesAsync()
+{
+    if (IsRefreshing())
+        return;
+
+    WaitForRefresh();
+
+    const auto gameDirectoryPath = GetBakDirectoryPath() / "GAMES";
+    if (!std::filesystem::exists(gameDirectoryPath))
+    {
+        // Creates the directory and logs on this thread
+        mDirectories = MakeSaveDirectories();
+        return;
+    }
+
+    mCancelRefresh = false;
+    mRefreshFinished = false;
+    mRefreshedDirectories.clear();
+    mRefresh = std::async(std::launch::async, [this]{
+        ForEachSaveDirectory([this](SaveDirectory&& directory){
+            auto lock = std::lock_guard{mPendingMutex};
+            mPendingDirectories.emplace_back(std::move(directory));
+        });
+        auto lock = std::lock_guard{mPendingMutex};
+        mRefreshFinished = true;
+    });
+}
+
+bool SaveManager::PollSaves()
+{
+    auto pending = std::vector<SaveDirectory>{};
+    bool finished = false;
+    {
+        auto lock = std::lock_guard{mPendingMutex};
+        std::swap(pending, mPendingDirectories);
+        finished = mRefreshFinished;
+        mRefreshFinished = false;
+    }
+
+    for (auto& directory : pending)
+    {
+        mRefreshedDirectories.emplace_back(directory.mIndex, directory.mName);
+        MergeDirectory(std::move(directory));
+    }
+
+    bool removed = false;
+    if (finished)
+    {
+        // Drop any directories that no longer exist on disk
+        const auto it = std::remove_if(
+            mDirectories.begin(), mDirectories.end(),
+            [&](const auto& dir){
+                return std::find(
+                    mRefreshedDirectories.begin(), mRefreshedDirectories.end(),
+                    std::make_pair(dir.mIndex, dir.mName)) == mRefreshedDirectories.end();
+            });
+        removed = it != mDirectories.end();
+        mDirectories.erase(it, mDirectories.end());
+        mRefreshedDirectories.clear();
+    }
+
+    return !pending.empty() || removed;
+}
+
+bool SaveManager::IsRefreshing() const
+{
+    using namespace std::chrono_literals;
+    return mRefresh.valid()
+        && mRefresh.wait_for(0s) != std::future_status::ready;
+}
+
+void SaveManager::MergeDirectory(SaveDirectory&& directory)
+{
+    const auto it = std::find_if(mDirectories.begin(), mDirectories.end(),
+        [&](const auto& elem){
+            return elem.mIndex == directory.mIndex
+                && elem.mName == directory.mName;
+        });
+    if (it != mDirectories.end())
+    {
+        *it = std::move(directory);
+    }
+    else
+    {
+        mDirectories.insert(
+            std::upper_bound(
+                mDirectories.begin(), mDirectories.end(),
+                directory.mIndex,
+                [](const auto index, const auto& elem){ return index < elem.mIndex; }),
+            std::move(directory));
+    }
+}
+
+void SaveManager::WaitForRefresh()
+{
+    if (mRefresh.valid())
+    {
+        try
+        {
+            mRefresh.get();
+        }
+        catch (const std::filesystem::filesystem_error& error)
+        {
+            mLogger.Error() << "Failed to refresh saves: " << error.what() << std::endl;
+        }
+        PollSaves();
+    }
+}
+
 void SaveManager::RemoveDirectory(unsigned index)
 {
+    WaitForRefresh();
     mLogger.Info() << "Removing save directory: " << mDirectories.at(index) << "\n";
     std::filesystem::remove_all(mSavePath / mDirectories.at(index).GetPath());
     RefreshSaves();
@@ -46,6 +329,7 @@ void SaveManager::RemoveDirectory(unsigned index)
 
 void SaveManager::RemoveSave(unsigned directory, unsigned save)
 {
+    WaitForRefresh();
     mLogger.Info() << "Removing save file: "
         << mDirectories.at(directory).mSaves.at(save).mPath << "\n";
     std::filesystem::remove(mDirectories.at(directory).mSaves.at(save).mPath);
@@ -56,6 +340,7 @@ const SaveFile& SaveManager::MakeSave(
     const std::string& saveDirectory,
     const std::string& saveName)
 {
+    WaitForRefresh();
     mLogger.Debug() << __FUNCTION__ << "(" << saveDirectory << ", " << saveName << std::endl;
     const auto it = std::find_if(mDirectories.begin(), mDirectories.end(),
         [&](const auto& elem){
@@ -103,35 +388,6 @@ const SaveFile& SaveManager::MakeSave(
     }
 }
 
-std::vector<SaveFile> SaveManager::MakeSaveFiles(std::filesystem::path saveDir)
-{
-    const auto saveSuffix = std::regex{"[Ss][Aa][Vv][Ee]([0-9]{2}).[Gg][Aa][mM]$"};
-    const auto saveFileDir = std::filesystem::directory_iterator{saveDir};
-
-    std::vector<SaveFile> saveFiles{};
-    for (const auto& save : saveFileDir)
-    {
-        const auto saveName = save.path().filename().string();
-        Logging::LogDebug(__FUNCTION__) << "Save: " << saveName << " matches: " << std::regex_search(saveName, saveSuffix) << std::endl;
-        std::smatch matches{};
-        std::regex_search(saveName, matches, saveSuffix);
-        if (matches.size() > 0)
-        {
-            auto fb = File::CreateFileBuffer(save.path().string());
-            saveFiles.emplace_back(
-                SaveFile{
-                    convertToInt(matches.str(1)),
-                    LoadSaveName(fb),
-                    save.path().string()});
-        }
-    }
-
-    std::sort(
-        saveFiles.begin(), saveFiles.end(),
-        [](const auto& lhs, const auto& rhs){ return lhs.mIndex < rhs.mIndex; });
-
-    return saveFiles;
-}
 
 std::vector<SaveDirectory> SaveManager::MakeSaveDirectories()
 {
@@ -154,26 +410,11 @@ std::vector<SaveDirectory> SaveManager::MakeSaveDirectories()
         return saveDirs;
     }
 
-    const auto saveDirectories = std::filesystem::directory_iterator{
-        gameDirectoryPath};
-
-    const auto dirSuffix = std::regex{".[Gg]([0-9]{2})$"};
+    ForEachSaveDirectory([&](SaveDirectory&& directory){
+        mLogger.Debug() << "Directory: " << directory << "\n";
+        saveDirs.emplace_back(std::move(directory));
+    });
 
-    for (const auto& directory : saveDirectories)
-    {
-        const auto dirName = directory.path().filename().string();
-        Logging::LogDebug(__FUNCTION__) << "Directory: " << dirName << " matches: " << std::regex_search(dirName, dirSuffix) << std::endl;
-        std::smatch matches{};
-        std::regex_search(dirName, matches, dirSuffix);
-        if (matches.size() > 0)
-        {
-            saveDirs.emplace_back(
-                SaveDirectory{
-                    convertToInt(matches.str(1)),
-                    directory.path().stem().string(),
-                    MakeSaveFiles(directory.path())});
-        }
-    }
     std::sort(
         saveDirs.begin(), saveDirs.end(),
         [](const auto& lhs, const auto& rhs){ return lhs.mIndex < rhs.mIndex; });
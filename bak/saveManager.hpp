@@ -6,12 +6,18 @@
 #include "com/path.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
+#include <future>
+#include <mutex>
 #include <regex>
 
 namespace BAK {
 
 std::string LoadSaveName(FileBuffer& fb);
+// Reads only the name region at the start of the save file
+std::string LoadSaveName(const std::filesystem::path& savePath);
 
 class SaveFile
 {
@@ -48,14 +54,54 @@ std::ostream& operator<<(auto& os, const SaveDirectory& saveDir)
     return os;
 }
 
+// Cached save names of a single save directory. An entry is only
+// valid while the size and modification time of its save file match.
+class SaveIndex
+{
+public:
+    static constexpr auto sIndexFile = "SAVES.IDX";
+
+    struct Entry
+    {
+        std::string mFile;
+        std::uintmax_t mSize;
+        std::int64_t mModified;
+        std::string mName;
+    };
+
+    explicit SaveIndex(std::filesystem::path saveDir);
+
+    const Entry* Find(
+        const std::string& file,
+        std::uintmax_t size,
+        std::int64_t modified) const;
+
+    std::size_t GetEntryCount() const;
+    void Write(const std::vector<Entry>&) const;
+
+private:
+    std::filesystem::path mIndexPath;
+    std::vector<Entry> mEntries;
+};
+
 class SaveManager
 {
 public:
     SaveManager(const std::string& savePath);
+    ~SaveManager();
 
     const std::vector<SaveDirectory>& GetSaves() const;
     void RefreshSaves();
 
+    // Scans the save directories on a worker thread. Results are
+    // merged into GetSaves() by PollSaves as each directory completes.
+    void RefreshSavesAsync();
+    // Returns true if the saves changed since the last call
+    bool PollSaves();
+    bool IsRefreshing() const;
+    // Blocks until the refresh is done and merges what it found
+    void WaitForRefresh();
+
     void RemoveDirectory(unsigned index);
     void RemoveSave(unsigned directory, unsigned save);
 
@@ -65,10 +111,20 @@ public:
 private:
     std::vector<SaveFile> MakeSaveFiles(std::filesystem::path saveDir);
     std::vector<SaveDirectory> MakeSaveDirectories();
+    template <typename F>
+    void ForEachSaveDirectory(F&& onDirectory);
+    void MergeDirectory(SaveDirectory&& directory);
 
     std::filesystem::path mSavePath;
     std::vector<SaveDirectory> mDirectories;
 
+    std::future<void> mRefresh;
+    std::atomic_bool mCancelRefresh;
+    std::mutex mPendingMutex;
+    std::vector<SaveDirectory> mPendingDirectories;
+    bool mRefreshFinished;
+    std::vector<std::pair<unsigned, std::string>> mRefreshedDirectories;
+
     const Logging::Logger& mLogger;
 };
 
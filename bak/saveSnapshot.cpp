@@ -0,0 +1,69 @@
+#include "bak/saveSnapshot.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace BAK {
+
+SavePages::SavePages(unsigned size, std::vector<std::shared_ptr<const Page>>&& pages)
+:
+    mSize{size},
+    mPages{std::move(pages)}
+{}
+
+SavePages SavePages::Capture(FileBuffer& fb, const SavePages* previous)
+{
+    const auto size = fb.GetSize();
+    const auto pageCount = (size + sPageSize - 1) / sPageSize;
+    if (previous && previous->GetSize() != size)
+        previous = nullptr;
+
+    fb.Seek(0);
+    const auto* data = fb.GetCurrent();
+
+    auto pages = std::vector<std::shared_ptr<const Page>>{};
+    pages.reserve(pageCount);
+    for (unsigned i = 0; i < pageCount; i++)
+    {
+        const auto offset = i * sPageSize;
+        const auto length = std::min(sPageSize, size - offset);
+        if (previous
+            && std::memcmp(previous->mPages[i]->data(), data + offset, length) == 0)
+        {
+            pages.emplace_back(previous->mPages[i]);
+        }
+        else
+        {
+            auto page = std::make_shared<Page>();
+            std::memcpy(page->data(), data + offset, length);
+            pages.emplace_back(std::move(page));
+        }
+    }
+
+    return SavePages{size, std::move(pages)};
+}
+
+void SavePages::Restore(FileBuffer& fb) const
+{
+    ASSERT(fb.GetSize() == mSize);
+    fb.Seek(0);
+    auto* data = fb.GetCurrent();
+    for (unsigned i = 0; i < mPages.size(); i++)
+    {
+        const auto offset = i * sPageSize;
+        const auto length = std::min(sPageSize, mSize - offset);
+        std::memcpy(data + offset, mPages[i]->data(), length);
+    }
+}
+
+unsigned SavePages::CountSharedPages(const SavePages& other) const
+{
+    unsigned shared = 0;
+    const auto count = std::min(mPages.size(), other.mPages.size());
+    for (unsigned i = 0; i < count; i++)
+        if (mPages[i] == other.mPages[i])
+            shared++;
+    return shared;
+}
+
+}
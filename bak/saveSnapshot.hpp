@@ -0,0 +1,79 @@
+#pragma once
+
+#include "bak/file/fileBuffer.hpp"
+
+#include "com/assert.hpp"
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace BAK {
+
+// An in-memory copy of a save buffer split into fixed size pages.
+// Pages that match the previous image are shared rather than copied,
+// so consecutive images only pay for what changed between them.
+class SavePages
+{
+public:
+    static constexpr unsigned sPageSize = 4096;
+    using Page = std::array<std::uint8_t, sPageSize>;
+
+    static SavePages Capture(FileBuffer& fb, const SavePages* previous);
+
+    // Overwrites the buffer contents, the buffer must be the same size
+    void Restore(FileBuffer& fb) const;
+
+    unsigned GetSize() const { return mSize; }
+    unsigned GetPageCount() const { return mPages.size(); }
+    unsigned CountSharedPages(const SavePages& other) const;
+
+private:
+    SavePages(unsigned size, std::vector<std::shared_ptr<const Page>>&& pages);
+
+    unsigned mSize;
+    std::vector<std::shared_ptr<const Page>> mPages;
+};
+
+// Keeps the most recent N snapshots, the oldest is dropped first
+template <typename T>
+class SnapshotRing
+{
+public:
+    explicit SnapshotRing(unsigned capacity)
+    :
+        mCapacity{capacity},
+        mSnapshots{}
+    {
+        ASSERT(mCapacity > 0);
+    }
+
+    void Push(T&& snapshot)
+    {
+        if (mSnapshots.size() == mCapacity)
+            mSnapshots.pop_front();
+        mSnapshots.emplace_back(std::move(snapshot));
+    }
+
+    // Age 0 is the most recent snapshot
+    const T* Get(unsigned age) const
+    {
+        if (age >= mSnapshots.size())
+            return nullptr;
+        return &mSnapshots[mSnapshots.size() - 1 - age];
+    }
+
+    const T* GetLatest() const { return Get(0); }
+
+    std::size_t size() const { return mSnapshots.size(); }
+    bool empty() const { return mSnapshots.empty(); }
+    void Clear() { mSnapshots.clear(); }
+
+private:
+    std::size_t mCapacity;
+    std::deque<T> mSnapshots;
+};
+
+}
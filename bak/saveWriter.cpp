@@ -0,0 +1,149 @@
+#include "bak/saveWriter.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace BAK {
+
+SaveWriter& SaveWriter::Get()
+{
+    static SaveWriter writer{};
+    return writer;
+}
+
+SaveWriter::SaveWriter()
+:
+    mMutex{},
+    mJobReady{},
+    mJobsDone{},
+    mJobs{},
+    mResults{},
+    mWriting{false},
+    mStop{false},
+    mThread{},
+    mLogger{Logging::LogState::GetLogger("BAK::SaveWriter")}
+{
+    mThread = std::thread{[this]{ Run(); }};
+}
+
+SaveWriter::~SaveWriter()
+{
+    {
+        auto lock = std::unique_lock{mMutex};
+        mStop = true;
+    }
+    mJobReady.notify_one();
+    // Pending jobs are drained before the thread exits
+    mThread.join();
+}
+
+void SaveWriter::Submit(
+    std::string path,
+    std::vector<std::uint8_t>&& bytes,
+    Callback&& onComplete)
+{
+    mLogger.Info() << "Queueing save to: " << path
+        << " (" << bytes.size() << " bytes)" << std::endl;
+    {
+        auto lock = std::unique_lock{mMutex};
+        mJobs.emplace_back(Job{std::move(path), std::move(bytes), std::move(onComplete)});
+    }
+    mJobReady.notify_one();
+}
+
+void SaveWriter::PollCompleted()
+{
+    auto results = std::vector<Result>{};
+    {
+        auto lock = std::unique_lock{mMutex};
+        if (mResults.empty())
+            return;
+        std::swap(results, mResults);
+    }
+
+    for (auto& result : results)
+    {
+        if (result.mSuccess)
+            mLogger.Info() << "Saved game to: " << result.mPath << std::endl;
+        else
+            mLogger.Error() << "Failed to save game to: " << result.mPath << std::endl;
+
+        if (result.mOnComplete)
+            result.mOnComplete(result.mSuccess);
+    }
+}
+
+void SaveWriter::Flush()
+{
+    auto lock = std::unique_lock{mMutex};
+    mJobsDone.wait(lock, [this]{ return mJobs.empty() && !mWriting; });
+}
+
+bool SaveWriter::IsWriting() const
+{
+    auto lock = std::unique_lock{mMutex};
+    return !mJobs.empty() || mWriting;
+}
+
+void SaveWriter::Run()
+{
+    // Never log from here, the logger isn't thread safe
+    while (true)
+    {
+        auto job = Job{};
+        {
+            auto lock = std::unique_lock{mMutex};
+            mJobReady.wait(lock, [this]{ return mStop || !mJobs.empty(); });
+            if (mJobs.empty())
+                return;
+            job = std::move(mJobs.front());
+            mJobs.pop_front();
+            mWriting = true;
+        }
+
+        const bool success = WriteAtomically(job);
+
+        {
+            auto lock = std::unique_lock{mMutex};
+            mResults.emplace_back(
+                Result{std::move(job.mPath), success, std::move(job.mOnComplete)});
+            mWriting = false;
+        }
+        mJobsDone.notify_all();
+    }
+}
+
+bool SaveWriter::WriteAtomically(const Job& job)
+{
+    const auto path = std::filesystem::path{job.mPath};
+    auto tmpPath = path;
+    tmpPath += ".tmp";
+
+    {
+        auto out = std::ofstream{tmpPath, std::ios::binary | std::ios::out | std::ios::trunc};
+        if (!out)
+            return false;
+        out.write(
+            reinterpret_cast<const char*>(job.mBytes.data()),
+            job.mBytes.size());
+        out.flush();
+        if (!out)
+        {
+            out.close();
+            std::error_code ec{};
+            std::filesystem::remove(tmpPath, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec{};
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tmpPath, ec);
+        return false;
+    }
+    return true;
+}
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "com/logger.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BAK {
+
+// Writes save files on a background thread. Each file is written to
+// a temporary next to the destination and renamed over it, so a crash
+// mid-write never leaves a truncated save behind.
+class SaveWriter
+{
+public:
+    using Callback = std::function<void(bool)>;
+
+    static SaveWriter& Get();
+
+    ~SaveWriter();
+
+    // Takes ownership of a snapshot of the save buffer, the callback
+    // is run on the thread that calls PollCompleted
+    void Submit(
+        std::string path,
+        std::vector<std::uint8_t>&& bytes,
+        Callback&& onComplete);
+
+    // Run the callbacks of completed writes
+    void PollCompleted();
+    // Block until every submitted write has hit the disk
+    void Flush();
+    bool IsWriting() const;
+
+private:
+    SaveWriter();
+
+    SaveWriter& operator=(const SaveWriter&) noexcept = delete;
+    SaveWriter(const SaveWriter&) noexcept = delete;
+    SaveWriter& operator=(SaveWriter&&) noexcept = delete;
+    SaveWriter(SaveWriter&&) noexcept = delete;
+
+    struct Job
+    {
+        std::string mPath;
+        std::vector<std::uint8_t> mBytes;
+        Callback mOnComplete;
+    };
+
+    struct Result
+    {
+        std::string mPath;
+        bool mSuccess;
+        Callback mOnComplete;
+    };
+
+    void Run();
+    static bool WriteAtomically(const Job&);
+
+    mutable std::mutex mMutex;
+    std::condition_variable mJobReady;
+    std::condition_variable mJobsDone;
+    std::deque<Job> mJobs;
+    std::vector<Result> mResults;
+    bool mWriting;
+    bool mStop;
+    std::thread mThread;
+
+    const Logging::Logger& mLogger;
+};
+
+}
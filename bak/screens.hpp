@@ -4,8 +4,10 @@
 #include "bak/dialog.hpp"
 #include "bak/gameData.hpp"
 
+#include "graphics/profiler.hpp"
 #include "graphics/renderer.hpp"
 
+#include "com/allocationTracker.hpp"
 #include "com/logger.hpp"
 #include "com/ostream.hpp"
 
@@ -17,6 +19,7 @@
 
 #include <GLFW/glfw3.h>
 
+#include <filesystem>
 #include <stack>
 #include <sstream>
 
@@ -147,3 +150,69 @@ void ShowLightGui(
 
     ImGui::End();
 }
+
+void ShowProfilerGui(
+    Graphics::Profiler& profiler,
+    const std::filesystem::path& tracePath)
+{
+    using Profiler = Graphics::Profiler;
+    constexpr auto sTraceFrames = 120;
+
+    ImGui::Begin("Profiler");
+
+    const auto& frames = profiler.GetFrameHistory();
+    ImGui::Text("Frame (CPU) avg %.3f ms", Profiler::Average(frames));
+    ImGui::PlotLines("##frames", frames.data(), frames.size(),
+        profiler.GetHistoryOffset(), nullptr, 0.0f, FLT_MAX, ImVec2{0, 60});
+
+    if (Allocations::IsTracking())
+    {
+        const auto& allocations = profiler.GetLastFrameAllocations();
+        ImGui::Text("Frame allocations %llu (%llu bytes) frees %llu",
+            static_cast<unsigned long long>(allocations.mAllocations),
+            static_cast<unsigned long long>(allocations.mBytes),
+            static_cast<unsigned long long>(allocations.mFrees));
+    }
+    else
+    {
+        ImGui::Text("Allocation tracking off (BAK_TRACK_ALLOCATIONS)");
+    }
+
+    if (profiler.IsCapturing())
+        ImGui::Text("Capturing trace...");
+    else if (ImGui::Button("Capture trace"))
+        profiler.CaptureTrace(tracePath, sTraceFrames);
+
+    ImGui::BeginTable("Passes", 8, ImGuiTableFlags_Resizable);
+    ImGui::TableSetupColumn("Pass");
+    ImGui::TableSetupColumn("CPU ms");
+    ImGui::TableSetupColumn("GPU ms");
+    ImGui::TableSetupColumn("Draws");
+    ImGui::TableSetupColumn("Tris");
+    ImGui::TableSetupColumn("Uniforms");
+    ImGui::TableSetupColumn("Allocs");
+    ImGui::TableSetupColumn("Bytes");
+    ImGui::TableHeadersRow();
+
+    for (const auto& pass : profiler.GetPasses())
+    {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn(); ImGui::Text("%s", pass.mName.c_str());
+        ImGui::TableNextColumn(); ImGui::Text("%.3f", Profiler::Average(pass.mCpuHistory));
+        ImGui::TableNextColumn();
+        if (pass.mGpu)
+            ImGui::Text("%.3f", Profiler::Average(pass.mGpuHistory));
+        else
+            ImGui::Text("-");
+        ImGui::TableNextColumn(); ImGui::Text("%u", pass.mLastCounters.mDrawCalls);
+        ImGui::TableNextColumn(); ImGui::Text("%u", pass.mLastCounters.mTriangles);
+        ImGui::TableNextColumn(); ImGui::Text("%u", pass.mLastCounters.mUniformUploads);
+        ImGui::TableNextColumn(); ImGui::Text("%llu",
+            static_cast<unsigned long long>(pass.mLastCounters.mAllocations));
+        ImGui::TableNextColumn(); ImGui::Text("%llu",
+            static_cast<unsigned long long>(pass.mLastCounters.mAllocatedBytes));
+    }
+    ImGui::EndTable();
+
+    ImGui::End();
+}
@@ -46,6 +46,18 @@ struct CharacterTestFixture : public ::testing::Test
             0, 0, 0, 0, 0,
             0, 0, 0}
         );
+        mObjects.emplace_back(GameObject{
+            "Ring",
+            1, 1, 1,
+            1, 1, 1, 1,
+            0, 1, 0, 0, 0, 0,
+            RacialModifier::None,
+            0,
+            ItemType::Other,
+            0, 0, 0,
+            1 << static_cast<unsigned>(SkillType::Lockpick), 5,
+            0, 0, 0}
+        );
         mObjects.emplace_back(GameObject{
             "Stack",
             0x0800, 1, 1,
@@ -91,6 +103,42 @@ protected:
     std::vector<GameObject> mObjects;
 };
 
+TEST_F(CharacterTestFixture, SkillSnapshotTracksInventory)
+{
+    auto skills = Skills::SkillArray{};
+    for (auto& skill : skills)
+        skill = Skill{40, 40, 40, 0, 0, false, false};
+    // Spellcasters have a casting skill, keep this one a swordsman
+    skills[static_cast<unsigned>(SkillType::Casting)] = Skill{};
+
+    auto character = Character{
+        0,
+        "Locklear",
+        Skills{skills, 0},
+        Spells{{}},
+        {},
+        {},
+        Conditions{},
+        Inventory{5}};
+
+    EXPECT_EQ(character.GetSkill(SkillType::Lockpick), 40);
+    EXPECT_EQ(character.GetSkill(SkillType::TotalHealth), 80);
+    const auto version = character.GetSkillSnapshot().mVersion;
+
+    // Reading again does not recalculate
+    EXPECT_EQ(character.GetMaxSkill(SkillType::Lockpick), 40);
+    EXPECT_EQ(character.GetSkillSnapshot().mVersion, version);
+
+    const auto ring = MakeItem("Ring", 1);
+    ASSERT_TRUE(character.GiveItem(ring));
+    EXPECT_EQ(character.GetSkill(SkillType::Lockpick), 45);
+    EXPECT_EQ(character.GetSkills().GetSkill(SkillType::Lockpick).mModifier, 5);
+    EXPECT_NE(character.GetSkillSnapshot().mVersion, version);
+
+    ASSERT_TRUE(character.RemoveItem(ring));
+    EXPECT_EQ(character.GetSkill(SkillType::Lockpick), 40);
+}
+
 TEST(CharacterTest, CheckAndSetStatus)
 {
     {
@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+
+#include "bak/eventFlags.hpp"
+
+#include <vector>
+
+namespace BAK {
+
+struct EventFlagsTestFixture : public ::testing::Test
+{
+    EventFlagsTestFixture()
+    :
+        mData(0x4000, 0),
+        mEventFlags{mData.data(), static_cast<unsigned>(mData.size())}
+    {}
+
+    std::vector<std::uint8_t> mData;
+    EventFlags mEventFlags;
+};
+
+TEST_F(EventFlagsTestFixture, LocateEvent)
+{
+    const auto location = EventFlags::LocateEvent(0x1464);
+    EXPECT_EQ(location.mByteOffset, (0xfffe & (0x1464 >> 3)) + 0x6e2);
+    EXPECT_EQ(location.mBitOffset, 0x4);
+
+    const auto complex = EventFlags::LocateComplexEvent(0xdac3);
+    EXPECT_EQ(complex.mByteOffset, ((0xdac3 + 0x2540) & 0xffff) / 10 + 0xb09);
+    EXPECT_EQ(complex.mBitOffset, 2);
+}
+
+TEST_F(EventFlagsTestFixture, WriteAndRead)
+{
+    EXPECT_FALSE(mEventFlags.ReadBool(0x1464));
+    mEventFlags.Write(0x1464, 1);
+    EXPECT_TRUE(mEventFlags.ReadBool(0x1464));
+    EXPECT_FALSE(mEventFlags.ReadBool(0x1465));
+
+    const auto location = EventFlags::LocateEvent(0x1464);
+    EXPECT_EQ(mData[location.mByteOffset], 0x10);
+
+    mEventFlags.Write(0x1464, 0);
+    EXPECT_FALSE(mEventFlags.ReadBool(0x1464));
+}
+
+TEST_F(EventFlagsTestFixture, HighBitsAreLittleEndian)
+{
+    mEventFlags.Write(0x100f, 1);
+    const auto location = EventFlags::LocateEvent(0x100f);
+    EXPECT_EQ(mData[location.mByteOffset], 0);
+    EXPECT_EQ(mData[location.mByteOffset + 1], 0x80);
+    EXPECT_TRUE(mEventFlags.ReadBool(0x100f));
+}
+
+TEST_F(EventFlagsTestFixture, BatchRead)
+{
+    mEventFlags.Write(0x10, 1);
+    mEventFlags.Write(0x12, 1);
+
+    const auto eventPtrs = std::vector<unsigned>{0x10, 0x11, 0x12};
+    auto states = std::vector<unsigned>(eventPtrs.size());
+    mEventFlags.Read(eventPtrs, states);
+    EXPECT_EQ(states[0] & 1, 1);
+    EXPECT_EQ(states[1] & 1, 0);
+    EXPECT_EQ(states[2] & 1, 1);
+
+    EXPECT_TRUE(mEventFlags.AnySet(eventPtrs));
+    EXPECT_FALSE(mEventFlags.AnySet(std::vector<unsigned>{0x11, 0x13}));
+}
+
+}
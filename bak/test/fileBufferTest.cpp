@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+
+#include "bak/file/fileBuffer.hpp"
+
+#include "com/random.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace BAK {
+
+static FileBuffer ToFileBuffer(const std::vector<std::uint8_t>& data)
+{
+    auto fb = FileBuffer{static_cast<unsigned>(data.size())};
+    fb.PutData(const_cast<std::uint8_t*>(data.data()), data.size());
+    fb.Rewind();
+    return fb;
+}
+
+static std::vector<std::uint8_t> ToVector(const FileBuffer& fb, unsigned size)
+{
+    return std::vector<std::uint8_t>(fb.GetBuffer(), fb.GetBuffer() + size);
+}
+
+// Runs of a few byte values, so there is plenty to compress
+static std::vector<std::uint8_t> MakeData(unsigned size)
+{
+    auto data = std::vector<std::uint8_t>{};
+    std::uint64_t counter = 0;
+    while (data.size() < size)
+    {
+        const auto x = Random::Generate(1, counter++);
+        const auto run = 1 + Random::Bounded(x, 9);
+        const auto value = static_cast<std::uint8_t>((x >> 8) & 0xf);
+        for (unsigned i = 0; i < run && data.size() < size; i++)
+            data.emplace_back(value);
+    }
+    return data;
+}
+
+static std::vector<std::uint8_t> RoundTrip(const std::vector<std::uint8_t>& data, unsigned method)
+{
+    auto input = ToFileBuffer(data);
+    auto compressed = FileBuffer{static_cast<unsigned>(data.size() * 2 + 16)};
+    const auto compressedSize = input.Compress(&compressed, method);
+    EXPECT_GT(compressedSize, 0u);
+    EXPECT_LT(compressedSize, data.size());
+
+    auto stream = FileBuffer{compressedSize};
+    stream.CopyFrom(&compressed, compressedSize);
+    stream.Rewind();
+
+    auto output = FileBuffer{static_cast<unsigned>(data.size())};
+    const auto size = method == COMPRESSION_LZW
+        ? stream.DecompressLZW(&output)
+        : stream.Decompress(&output, method);
+    EXPECT_EQ(size, data.size());
+    return ToVector(output, size);
+}
+
+TEST(FileBufferTest, RewindResetsBitPosition)
+{
+    auto fb = ToFileBuffer({0b10110101, 0xff});
+    EXPECT_EQ(fb.GetBits(3), 0b101u);
+    EXPECT_EQ(fb.GetNextBit(), 3u);
+
+    fb.Rewind();
+    EXPECT_EQ(fb.GetNextBit(), 0u);
+    EXPECT_EQ(fb.GetBits(8), 0b10110101u);
+    EXPECT_EQ(fb.GetBits(8), 0xffu);
+}
+
+TEST(FileBufferTest, DecompressLZSSOverlappingCopy)
+{
+    // Two literals, then an 8 byte copy from offset 0 which reads
+    // the bytes it is writing
+    auto stream = ToFileBuffer({0b011, 'a', 'b', 0x00, 0x00, 8 - 5});
+    auto output = FileBuffer{10};
+    EXPECT_EQ(stream.DecompressLZSS(&output), 10u);
+
+    const auto expected = std::vector<std::uint8_t>{
+        'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b', 'a', 'b'};
+    EXPECT_EQ(ToVector(output, 10), expected);
+}
+
+TEST(FileBufferTest, LZWRoundTrip)
+{
+    // Enough to fill the code table
+    const auto data = MakeData(100000);
+    EXPECT_EQ(RoundTrip(data, COMPRESSION_LZW), data);
+}
+
+TEST(FileBufferTest, LZSSRoundTrip)
+{
+    // Longer than a copy offset can reach
+    const auto data = MakeData(100000);
+    EXPECT_EQ(RoundTrip(data, COMPRESSION_LZSS), data);
+}
+
+TEST(FileBufferTest, RLERoundTrip)
+{
+    const auto data = MakeData(10000);
+    EXPECT_EQ(RoundTrip(data, COMPRESSION_RLE), data);
+}
+
+}
@@ -0,0 +1,27 @@
+#include "gtest/gtest.h"
+
+#include "bak/dialogChoice.hpp"
+#include "bak/gameState.hpp"
+
+#include <vector>
+
+namespace BAK {
+
+TEST(GameStateTest, BatchedEventStatesMatchSingleLookups)
+{
+    auto gameState = GameState{nullptr};
+    gameState.SetChapter(Chapter{3});
+
+    const auto eventPtrs = std::vector<unsigned>{
+        0x10,
+        static_cast<unsigned>(ActiveStateFlag::Chapter),
+        0x1464};
+    auto states = std::vector<unsigned>(eventPtrs.size(), 0xff);
+    gameState.GetEventStates(eventPtrs, states);
+
+    for (unsigned i = 0; i < eventPtrs.size(); i++)
+        EXPECT_EQ(states[i], gameState.GetEventState(eventPtrs[i])) << std::hex << eventPtrs[i];
+    EXPECT_EQ(states[1], 3);
+}
+
+}
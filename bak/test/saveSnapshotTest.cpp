@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+
+#include "bak/saveSnapshot.hpp"
+
+namespace BAK {
+
+struct SaveSnapshotTestFixture : public ::testing::Test
+{
+    SaveSnapshotTestFixture()
+    :
+        mBuffer{SavePages::sPageSize * 3 + 100}
+    {
+        for (unsigned i = 0; i < mBuffer.GetSize(); i++)
+            mBuffer.PutUint8(i & 0xff);
+    }
+
+    FileBuffer mBuffer;
+};
+
+TEST_F(SaveSnapshotTestFixture, CaptureAndRestore)
+{
+    const auto image = SavePages::Capture(mBuffer, nullptr);
+    EXPECT_EQ(image.GetPageCount(), 4);
+    EXPECT_EQ(image.GetSize(), mBuffer.GetSize());
+
+    mBuffer.Seek(10);
+    mBuffer.PutUint8(0xaa);
+    mBuffer.Seek(SavePages::sPageSize * 3 + 50);
+    mBuffer.PutUint8(0xbb);
+
+    image.Restore(mBuffer);
+    mBuffer.Seek(10);
+    EXPECT_EQ(mBuffer.GetUint8(), 10);
+    mBuffer.Seek(SavePages::sPageSize * 3 + 50);
+    EXPECT_EQ(mBuffer.GetUint8(), (SavePages::sPageSize * 3 + 50) & 0xff);
+}
+
+TEST_F(SaveSnapshotTestFixture, UnchangedPagesAreShared)
+{
+    const auto first = SavePages::Capture(mBuffer, nullptr);
+
+    mBuffer.Seek(SavePages::sPageSize + 1);
+    mBuffer.PutUint8(0xaa);
+    const auto second = SavePages::Capture(mBuffer, &first);
+    EXPECT_EQ(second.CountSharedPages(first), 3);
+
+    first.Restore(mBuffer);
+    mBuffer.Seek(SavePages::sPageSize + 1);
+    EXPECT_EQ(mBuffer.GetUint8(), (SavePages::sPageSize + 1) & 0xff);
+
+    second.Restore(mBuffer);
+    mBuffer.Seek(SavePages::sPageSize + 1);
+    EXPECT_EQ(mBuffer.GetUint8(), 0xaa);
+}
+
+TEST(SnapshotRingTest, DropsOldest)
+{
+    auto ring = SnapshotRing<unsigned>{2};
+    EXPECT_EQ(ring.GetLatest(), nullptr);
+    ring.Push(1);
+    ring.Push(2);
+    ring.Push(3);
+    EXPECT_EQ(ring.size(), 2);
+    EXPECT_EQ(*ring.Get(0), 3);
+    EXPECT_EQ(*ring.Get(1), 2);
+    EXPECT_EQ(ring.Get(2), nullptr);
+}
+
+}
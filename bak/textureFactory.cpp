@@ -3,7 +3,9 @@
 #include "bak/imageStore.hpp"
 #include "bak/screen.hpp"
 
-#include <random>
+#include "com/random.hpp"
+
+#include <algorithm>
 
 namespace BAK {
 
@@ -88,9 +90,8 @@ void TextureFactory::AddTerrainToTextureStore(
         }
         if (offset == 70)
         {
-            std::random_device rd;
-            std::mt19937 g(rd());
-            std::shuffle(image.begin(), image.end(), g);
+            auto engine = Random::Engine{RandomStream::Terrain};
+            std::shuffle(image.begin(), image.end(), engine);
         }
 
         startOff += offset;
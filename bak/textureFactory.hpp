@@ -13,6 +13,8 @@
 
 namespace BAK {
 
+Graphics::Texture ImageToTexture(const BAK::Image& image, const BAK::Palette& palette);
+
 class TextureFactory
 {
 public:
@@ -12,12 +12,14 @@
 
 #include "com/assert.hpp"
 #include "com/logger.hpp"
+#include "com/nameTable.hpp"
 
 #include "graphics/meshObject.hpp"
 
 #include "bak/fileBufferFactory.hpp"
 
 #include <functional>   
+#include <memory_resource>
 #include <optional>
 
 namespace BAK {
@@ -100,18 +102,21 @@ class ZoneItem
 public:
     ZoneItem(
         const Model& model,
-        const ZoneTextureStore& textureStore)
+        const ZoneTextureStore& textureStore,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     :
         mName{model.mName},
+        mNameHandle{InternName(mName)},
         mEntityFlags{model.mEntityFlags},
         mEntityType{static_cast<EntityType>(model.mEntityType)},
         mScale{static_cast<float>(1 << model.mScale)},
         mSpriteIndex{model.mSprite},
-        mColors{},
-        mVertices{},
-        mPalettes{},
-        mFaces{},
-        mPush{}
+        mColors(resource),
+        mVertices(resource),
+        mPalettes(resource),
+        mFaces(resource),
+        // Not braces, that would make a vector<bool> holding the pointer
+        mPush(resource)
     {
         if (mSpriteIndex == 0 || mSpriteIndex > 400)
         {
@@ -132,7 +137,7 @@ public:
                     {
                         for (const auto& face : faceOption.mFaces)
                         {
-                            mFaces.emplace_back(face);
+                            mFaces.emplace_back(face.begin(), face.end());
                         }
                         for (const auto& palette : faceOption.mPalettes)
                         {
@@ -189,7 +194,7 @@ public:
             faces.emplace_back(1);
             faces.emplace_back(2);
             faces.emplace_back(3);
-            mFaces.emplace_back(faces);
+            mFaces.emplace_back(faces.begin(), faces.end());
             mPush.emplace_back(false);
 
             mPalettes.emplace_back(0x91);
@@ -204,18 +209,21 @@ public:
     ZoneItem(
         unsigned i,
         const BAK::MonsterNames& monsters,
-        const ZoneTextureStore& textureStore)
+        const ZoneTextureStore& textureStore,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     :
         mName{monsters.GetMonsterAnimationFile(MonsterIndex{i})},
+        mNameHandle{monsters.GetMonsterAnimationHandle(MonsterIndex{i})},
         mEntityFlags{0},
         mEntityType{EntityType::DEADBODY1},
         mScale{1},
         mSpriteIndex{i + textureStore.GetHorizonOffset()},
-        mColors{},
-        mVertices{},
-        mPalettes{},
-        mFaces{},
-        mPush{}
+        mColors(resource),
+        mVertices(resource),
+        mPalettes(resource),
+        mFaces(resource),
+        // Not braces, that would make a vector<bool> holding the pointer
+        mPush(resource)
     {
         // Need this to set the right dimensions for the texture
         const auto& tex = textureStore.GetTexture(mSpriteIndex);
@@ -233,7 +241,7 @@ public:
         faces.emplace_back(1);
         faces.emplace_back(2);
         faces.emplace_back(3);
-        mFaces.emplace_back(faces);
+        mFaces.emplace_back(faces.begin(), faces.end());
         mPush.emplace_back(false);
 
         mPalettes.emplace_back(0x91);
@@ -246,6 +254,7 @@ public:
 
     void SetPush(unsigned i){ mPush[i] = true; }
     const std::string& GetName() const { return mName; }
+    NameHandle GetNameHandle() const { return mNameHandle; }
     bool IsSprite() const { return mSpriteIndex > 0 && mSpriteIndex < 400; }
     const auto& GetColors() const { return mColors; }
     const auto& GetFaces() const { return mFaces; }
@@ -294,15 +303,16 @@ public:
 
 private:
     std::string mName;
+    NameHandle mNameHandle;
     unsigned mEntityFlags;
     EntityType mEntityType;
     float mScale;
     unsigned mSpriteIndex;
-    std::vector<std::uint8_t> mColors;
-    std::vector<glm::vec<3, int>> mVertices;
-    std::vector<std::uint8_t> mPalettes;
-    std::vector<std::vector<std::uint16_t>> mFaces;
-    std::vector<bool> mPush;
+    std::pmr::vector<std::uint8_t> mColors;
+    std::pmr::vector<glm::vec<3, int>> mVertices;
+    std::pmr::vector<std::uint8_t> mPalettes;
+    std::pmr::vector<std::pmr::vector<std::uint16_t>> mFaces;
+    std::pmr::vector<bool> mPush;
 
     friend std::ostream& operator<<(std::ostream& os, const ZoneItem& d);
 };
@@ -321,20 +331,31 @@ public:
     ZoneItemStore(
         const ZoneLabel& zoneLabel,
         // Should one really need a texture store to load this?
-        const ZoneTextureStore& textureStore)
+        const ZoneTextureStore& textureStore,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     :
         mZoneLabel{zoneLabel},
-        mItems{}
+        mItems{resource},
+        mItemsByName{resource}
     {
         auto fb = FileBufferFactory::Get()
             .CreateDataBuffer(mZoneLabel.GetTable());
         const auto models = LoadTBL(fb);
 
+        mItems.reserve(models.size());
         for (unsigned i = 0; i < models.size(); i++)
         {
-            mItems.emplace_back(
+            const auto& item = mItems.emplace_back(
                 models[i],
-                textureStore);
+                textureStore,
+                resource);
+
+            const auto handle = item.GetNameHandle().mValue;
+            if (handle >= mItemsByName.size())
+                mItemsByName.resize(handle + 1);
+            // Keep the first item of a name, as the linear search did
+            if (!mItemsByName[handle])
+                mItemsByName[handle] = i;
         }
     }
 
@@ -348,21 +369,25 @@ public:
 
     const ZoneItem& GetZoneItem(const std::string& name) const
     {
-        auto it = std::find_if(mItems.begin(), mItems.end(),
-            [&name](const auto& item){
-            return name == item.GetName();
-            });
+        const auto handle = FindName(name);
+        ASSERT(handle);
+        return GetZoneItem(*handle);
+    }
 
-        ASSERT(it != mItems.end());
-        return *it;
+    const ZoneItem& GetZoneItem(NameHandle name) const
+    {
+        ASSERT(name.mValue < mItemsByName.size() && mItemsByName[name.mValue]);
+        return mItems[*mItemsByName[name.mValue]];
     }
 
-    const std::vector<ZoneItem>& GetItems() const { return mItems; }
-    std::vector<ZoneItem>& GetItems() { return mItems; }
+    const std::pmr::vector<ZoneItem>& GetItems() const { return mItems; }
+    std::pmr::vector<ZoneItem>& GetItems() { return mItems; }
 
 private:
     const ZoneLabel mZoneLabel;
-    std::vector<ZoneItem> mItems;
+    std::pmr::vector<ZoneItem> mItems;
+    // Index into mItems by NameHandle
+    std::pmr::vector<std::optional<unsigned>> mItemsByName;
 };
 
 class WorldItemInstance
@@ -408,12 +433,13 @@ public:
         Encounter::EncounterFactory ef,
         unsigned x,
         unsigned y,
-        unsigned tileIndex)
+        unsigned tileIndex,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     :
         mCenter{},
         mTile{x, y},
         mTileIndex{tileIndex},
-        mItemInsts{},
+        mItemInsts{resource},
         mEncounters{},
         mEmpty{}
     {
@@ -434,6 +460,7 @@ public:
         auto fb = FileBufferFactory::Get().CreateDataBuffer(tileWorld);
         const auto [tileWorldItems, tileCenter] = LoadWorldTile(fb);
 
+        mItemInsts.reserve(mItemInsts.size() + tileWorldItems.size());
         for (const auto& item : tileWorldItems)
         {
             if (item.mItemType == 0)
@@ -477,7 +504,7 @@ private:
     glm::vec<2, unsigned> mTile;
     unsigned mTileIndex;
 
-    std::vector<WorldItemInstance> mItemInsts;
+    std::pmr::vector<WorldItemInstance> mItemInsts;
     std::optional<Encounter::EncounterStore> mEncounters;
     std::vector<Encounter::Encounter> mEmpty;
 };
@@ -488,40 +515,35 @@ class WorldTileStore
 public:
     WorldTileStore(
         const ZoneItemStore& zoneItems,
-        const Encounter::EncounterFactory& ef)
+        const Encounter::EncounterFactory& ef,
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     :
-        mWorlds{
-            std::invoke([&zoneItems, &ef]()
-            {
-                const auto tiles = LoadZoneRef(
-                    zoneItems.GetZoneLabel().GetZoneReference());
-
-                std::vector<World> worlds{};
-                worlds.reserve(tiles.size());
-
-                for (unsigned tileIndex = 0; tileIndex < tiles.size(); tileIndex++)
-                {
-                    const auto& tile = tiles[tileIndex];
-                    auto it = worlds.emplace_back(
-                        zoneItems,
-                        ef,
-                        tile.x,
-                        tile.y,
-                        tileIndex);
-                }
+        mWorlds{resource}
+    {
+        const auto tiles = LoadZoneRef(
+            zoneItems.GetZoneLabel().GetZoneReference());
 
-                return worlds;
-            })
+        mWorlds.reserve(tiles.size());
+        for (unsigned tileIndex = 0; tileIndex < tiles.size(); tileIndex++)
+        {
+            const auto& tile = tiles[tileIndex];
+            mWorlds.emplace_back(
+                zoneItems,
+                ef,
+                tile.x,
+                tile.y,
+                tileIndex,
+                resource);
         }
-    {}
+    }
 
-    const std::vector<World>& GetTiles() const
+    const std::pmr::vector<World>& GetTiles() const
     {
         return mWorlds;
     }
 
 private:
-    std::vector<World> mWorlds;
+    std::pmr::vector<World> mWorlds;
 };
 
 }
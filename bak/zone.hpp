@@ -5,37 +5,45 @@
 #include "bak/resourceNames.hpp"
 #include "bak/palette.hpp"
 #include "bak/worldFactory.hpp"
+#include "bak/zoneArena.hpp"
+
+#include "com/logger.hpp"
 
 #include "graphics/cube.hpp"
 #include "graphics/meshObject.hpp"
 
 namespace BAK {
 
-// Contains all the data one would need for a zone
+// Contains all the data one would need for a zone. The zone's items,
+// tiles and meshes are allocated from mArena and released together
+// when the zone is destroyed.
 class Zone
 {
 public:
 
     Zone(unsigned zoneNumber)
     :
+        mArena{},
         mZoneLabel{zoneNumber},
         mPalette{mZoneLabel.GetPalette()},
         mFixedObjects{LoadFixedObjects(zoneNumber)},
         mZoneTextures{mZoneLabel, mPalette},
-        mZoneItems{mZoneLabel, mZoneTextures},
-        mWorldTiles{mZoneItems, BAK::Encounter::EncounterFactory{}},
-        mObjects{}
+        mZoneItems{mZoneLabel, mZoneTextures, &mArena},
+        mWorldTiles{mZoneItems, BAK::Encounter::EncounterFactory{}, &mArena},
+        mObjects{&mArena}
     {
+        // Built first so the mesh buffers are sized once in the arena
+        auto objects = std::vector<Graphics::MeshObjectStorage::NamedObject>{};
         for (auto& item : mZoneItems.GetItems())
-            mObjects.AddObject(
-                item.GetName(),
+            objects.emplace_back(
+                item.GetNameHandle(),
                 BAK::ZoneItemToMeshObject(item, mZoneTextures, mPalette));
 
         const auto monsters = MonsterNames{};
         for (unsigned i = 0; i < monsters.size(); i++)
         {
-            mObjects.AddObject(
-                monsters.GetMonsterAnimationFile(MonsterIndex{i}),
+            objects.emplace_back(
+                monsters.GetMonsterAnimationHandle(MonsterIndex{i}),
                 BAK::ZoneItemToMeshObject(
                     ZoneItem{i, monsters, mZoneTextures},
                     mZoneTextures,
@@ -44,23 +52,34 @@ public:
 
 
         const auto cube = Graphics::Cuboid{1, 1, 50};
-        mObjects.AddObject("Combat", cube.ToMeshObject(glm::vec4{1.0, 0, 0, .3}));
-        mObjects.AddObject("Trap", cube.ToMeshObject(glm::vec4{.8, 0, 0, .3}));
-        mObjects.AddObject("Dialog", cube.ToMeshObject(glm::vec4{0.0, 1, 0, .3}));
-        //mObjects.AddObject("Dialog", cube.ToMeshObject(glm::vec4{0.0, 1, 0, .0}));
-        mObjects.AddObject("Zone", cube.ToMeshObject(glm::vec4{1.0, 1, 0, .3}));
-        mObjects.AddObject("GDSEntry", cube.ToMeshObject(glm::vec4{1.0, 0, 1, .3}));
-        mObjects.AddObject("EventFlag", cube.ToMeshObject(glm::vec4{.0, .0, .7, .3}));
-        mObjects.AddObject("Block", cube.ToMeshObject(glm::vec4{0,0,0, .3}));
+        objects.emplace_back(InternName("Combat"), cube.ToMeshObject(glm::vec4{1.0, 0, 0, .3}));
+        objects.emplace_back(InternName("Trap"), cube.ToMeshObject(glm::vec4{.8, 0, 0, .3}));
+        objects.emplace_back(InternName("Dialog"), cube.ToMeshObject(glm::vec4{0.0, 1, 0, .3}));
+        //objects.emplace_back(InternName("Dialog"), cube.ToMeshObject(glm::vec4{0.0, 1, 0, .0}));
+        objects.emplace_back(InternName("Zone"), cube.ToMeshObject(glm::vec4{1.0, 1, 0, .3}));
+        objects.emplace_back(InternName("GDSEntry"), cube.ToMeshObject(glm::vec4{1.0, 0, 1, .3}));
+        objects.emplace_back(InternName("EventFlag"), cube.ToMeshObject(glm::vec4{.0, .0, .7, .3}));
+        objects.emplace_back(InternName("Block"), cube.ToMeshObject(glm::vec4{0,0,0, .3}));
 
         const auto click = Graphics::Cuboid{1, 1, 50};
-        mObjects.AddObject("clickable", click.ToMeshObject(glm::vec4{1.0, 0, 0, .3}));
+        objects.emplace_back(InternName("clickable"), click.ToMeshObject(glm::vec4{1.0, 0, 0, .3}));
 
         const auto enemy = Graphics::Cuboid{1, 1, 6};
-        mObjects.AddObject("enemy", enemy.ToMeshObject(glm::vec4{0.0, 1.0, 1.0, .8}));
+        objects.emplace_back(InternName("enemy"), enemy.ToMeshObject(glm::vec4{0.0, 1.0, 1.0, .8}));
+
+        mObjects.AddObjects(objects);
+
+        Logging::LogState::GetLogger("Zone").Info() << "Loaded zone: " << zoneNumber
+            << " arena used: " << mArena.GetBytesUsed() / 1024 << "KiB"
+            << " reserved: " << mArena.GetBytesReserved() / 1024 << "KiB"
+            << " in " << mArena.GetBlocks() << " blocks\n";
     }
 
-    
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+
+    // Declared first so it outlives everything allocated from it
+    ZoneArena mArena;
     ZoneLabel mZoneLabel;
     BAK::Palette mPalette;
     std::vector<GenericContainer> mFixedObjects;
@@ -0,0 +1,46 @@
+#include "bak/zoneArena.hpp"
+
+namespace BAK {
+
+ZoneArena::ZoneArena(std::size_t initialSize)
+:
+    mUpstream{},
+    mBuffer{initialSize, &mUpstream},
+    mBytesUsed{0}
+{
+}
+
+void* ZoneArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    mBytesUsed += bytes;
+    return mBuffer.allocate(bytes, alignment);
+}
+
+void ZoneArena::do_deallocate(void*, std::size_t, std::size_t)
+{
+    // Released with the arena
+}
+
+bool ZoneArena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+void* ZoneArena::Upstream::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    mBytesReserved += bytes;
+    mBlocks++;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void ZoneArena::Upstream::do_deallocate(void* p, std::size_t bytes, std::size_t alignment)
+{
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+bool ZoneArena::Upstream::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+}
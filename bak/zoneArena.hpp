@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace BAK {
+
+// Memory for the data loaded with a zone. Allocations are carved out of
+// a few large blocks and never individually freed, everything goes at
+// once when the zone is unloaded and the arena destroyed. Containers
+// allocated from it must not outlive it.
+class ZoneArena : public std::pmr::memory_resource
+{
+    // Roughly what a typical zone uses, so most need only a block or two
+    static constexpr std::size_t sInitialSize = 8 * 1024 * 1024;
+
+public:
+    explicit ZoneArena(std::size_t initialSize = sInitialSize);
+
+    ZoneArena(const ZoneArena&) = delete;
+    ZoneArena& operator=(const ZoneArena&) = delete;
+
+    // Nothing is freed before the arena goes, so this is also the peak
+    std::size_t GetBytesUsed() const { return mBytesUsed; }
+    // Bytes taken from the heap in blocks, including unused space
+    std::size_t GetBytesReserved() const { return mUpstream.mBytesReserved; }
+    std::size_t GetBlocks() const { return mUpstream.mBlocks; }
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    // Counts the blocks the monotonic buffer asks the heap for
+    class Upstream : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t mBytesReserved{0};
+        std::size_t mBlocks{0};
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+    };
+
+    Upstream mUpstream;
+    std::pmr::monotonic_buffer_resource mBuffer;
+    std::size_t mBytesUsed;
+};
+
+}
@@ -0,0 +1,167 @@
+#include "com/allocationTracker.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Allocations {
+
+namespace {
+
+// Only trivially initialised state so that it is usable from
+// operator new before any constructors have run
+constinit thread_local AllocationCounts tCounts{};
+constinit thread_local unsigned tUntracked{0};
+constinit std::atomic<std::uint64_t> gAllocations{0};
+constinit std::atomic<std::uint64_t> gBytes{0};
+constinit std::atomic<std::uint64_t> gFrees{0};
+
+[[maybe_unused]] void CountAllocation(std::size_t bytes)
+{
+    if (tUntracked > 0)
+        return;
+    tCounts.mAllocations++;
+    tCounts.mBytes += bytes;
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    gBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+[[maybe_unused]] void CountFree(void* p)
+{
+    if (p == nullptr || tUntracked > 0)
+        return;
+    tCounts.mFrees++;
+    gFrees.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
+
+AllocationCounts GetThreadCounts()
+{
+    return tCounts;
+}
+
+AllocationCounts GetTotalCounts()
+{
+    return AllocationCounts{
+        gAllocations.load(std::memory_order_relaxed),
+        gBytes.load(std::memory_order_relaxed),
+        gFrees.load(std::memory_order_relaxed)};
+}
+
+UntrackedScope::UntrackedScope()
+{
+    tUntracked++;
+}
+
+UntrackedScope::~UntrackedScope()
+{
+    tUntracked--;
+}
+
+}
+
+#ifdef BAK_TRACK_ALLOCATIONS
+
+namespace {
+
+void* Allocate(std::size_t size)
+{
+    Allocations::CountAllocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* AllocateAligned(std::size_t size, std::align_val_t align)
+{
+    Allocations::CountAllocation(size);
+    const auto alignment = static_cast<std::size_t>(align);
+#ifdef _MSC_VER
+    return _aligned_malloc(size == 0 ? 1 : size, alignment);
+#else
+    // aligned_alloc wants a multiple of the alignment
+    const auto rounded = (size + alignment - 1) & ~(alignment - 1);
+    return std::aligned_alloc(alignment, rounded == 0 ? alignment : rounded);
+#endif
+}
+
+void Free(void* p)
+{
+    Allocations::CountFree(p);
+    std::free(p);
+}
+
+void FreeAligned(void* p)
+{
+    Allocations::CountFree(p);
+#ifdef _MSC_VER
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+}
+
+void* operator new(std::size_t size)
+{
+    if (auto* p = Allocate(size))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    if (auto* p = Allocate(size))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return Allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    if (auto* p = AllocateAligned(size, align))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    if (auto* p = AllocateAligned(size, align))
+        return p;
+    throw std::bad_alloc{};
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, align);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    return AllocateAligned(size, align);
+}
+
+void operator delete(void* p) noexcept { Free(p); }
+void operator delete[](void* p) noexcept { Free(p); }
+void operator delete(void* p, std::size_t) noexcept { Free(p); }
+void operator delete[](void* p, std::size_t) noexcept { Free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { Free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { Free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { FreeAligned(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { FreeAligned(p); }
+
+#endif
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+
+// Counts heap allocations made through operator new. The counting
+// operator new/delete replacements are only built with the
+// BAK_TRACK_ALLOCATIONS CMake option, otherwise every count is zero.
+namespace Allocations {
+
+struct AllocationCounts
+{
+    std::uint64_t mAllocations;
+    std::uint64_t mBytes;
+    std::uint64_t mFrees;
+};
+
+inline AllocationCounts operator-(const AllocationCounts& lhs, const AllocationCounts& rhs)
+{
+    return AllocationCounts{
+        lhs.mAllocations - rhs.mAllocations,
+        lhs.mBytes - rhs.mBytes,
+        lhs.mFrees - rhs.mFrees};
+}
+
+constexpr bool IsTracking()
+{
+#ifdef BAK_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Allocations made by the calling thread since it started
+AllocationCounts GetThreadCounts();
+// Allocations made by every thread since the program started
+AllocationCounts GetTotalCounts();
+
+// Allocations the calling thread makes while this is alive aren't
+// counted. For calls into code we don't control, e.g. the GL driver
+// or the window system, which may allocate as it pleases.
+class UntrackedScope
+{
+public:
+    UntrackedScope();
+
+    UntrackedScope(const UntrackedScope&) = delete;
+    UntrackedScope& operator=(const UntrackedScope&) = delete;
+
+    ~UntrackedScope();
+};
+
+}
@@ -0,0 +1,56 @@
+#include "com/nameTable.hpp"
+
+#include "com/assert.hpp"
+
+#include <deque>
+#include <unordered_map>
+
+namespace {
+
+struct NameTable
+{
+    // deque so the strings, and the views of them used as keys,
+    // don't move as names are added
+    std::deque<std::string> mNames;
+    std::unordered_map<std::string_view, unsigned> mHandles;
+};
+
+NameTable& GetNameTable()
+{
+    static NameTable nameTable{};
+    return nameTable;
+}
+
+}
+
+NameHandle InternName(std::string_view name)
+{
+    auto& table = GetNameTable();
+    if (const auto it = table.mHandles.find(name); it != table.mHandles.end())
+        return NameHandle{it->second};
+
+    const auto handle = static_cast<unsigned>(table.mNames.size());
+    const auto& stored = table.mNames.emplace_back(name);
+    table.mHandles.emplace(stored, handle);
+    return NameHandle{handle};
+}
+
+std::optional<NameHandle> FindName(std::string_view name)
+{
+    const auto& table = GetNameTable();
+    if (const auto it = table.mHandles.find(name); it != table.mHandles.end())
+        return NameHandle{it->second};
+    return std::nullopt;
+}
+
+const std::string& GetInternedName(NameHandle handle)
+{
+    const auto& table = GetNameTable();
+    ASSERT(handle.mValue < table.mNames.size());
+    return table.mNames[handle.mValue];
+}
+
+unsigned GetNameCount()
+{
+    return static_cast<unsigned>(GetNameTable().mNames.size());
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "com/strongType.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Interned names. Each distinct string is given a small dense handle
+// the first time it's interned, so stores keyed by name can use a
+// vector indexed by handle instead of hashing strings. Names are never
+// removed, handles stay valid for the life of the program.
+//
+// Not thread safe, intern names on the thread that loads the game data.
+using NameHandle = StrongType<unsigned, struct NameHandleTag>;
+
+NameHandle InternName(std::string_view name);
+
+// The handle for name if it has already been interned
+std::optional<NameHandle> FindName(std::string_view name);
+
+const std::string& GetInternedName(NameHandle handle);
+
+// Number of names interned so far, handles are [0, GetNameCount())
+unsigned GetNameCount();
@@ -1,11 +1,68 @@
 #include "com/random.hpp"
 
+#include <array>
+#include <atomic>
 #include <random>
 
-unsigned GetRandomNumber(unsigned min, unsigned max)
+namespace {
+
+struct RandomState
+{
+    RandomState()
+    {
+        std::random_device randomDevice{};
+        Reseed((static_cast<std::uint64_t>(randomDevice()) << 32) | randomDevice());
+    }
+
+    void Reseed(std::uint64_t seed)
+    {
+        mSeed.store(seed);
+        for (unsigned i = 0; i < mStreams.size(); i++)
+        {
+            mStreams[i].mKey.store(Random::StreamKey(seed, static_cast<RandomStream>(i)));
+            mStreams[i].mCounter.store(0);
+        }
+    }
+
+    struct Stream
+    {
+        std::atomic<std::uint64_t> mKey;
+        std::atomic<std::uint64_t> mCounter;
+    };
+
+    std::atomic<std::uint64_t> mSeed;
+    std::array<Stream, static_cast<std::size_t>(RandomStream::NumStreams)> mStreams;
+};
+
+RandomState& GetRandomState()
+{
+    static RandomState state{};
+    return state;
+}
+
+}
+
+void SetRandomSeed(std::uint64_t seed)
+{
+    GetRandomState().Reseed(seed);
+}
+
+std::uint64_t GetRandomSeed()
+{
+    return GetRandomState().mSeed.load();
+}
+
+std::uint32_t GetRandom32(RandomStream stream)
+{
+    auto& state = GetRandomState().mStreams[static_cast<std::size_t>(stream)];
+    const auto counter = state.mCounter.fetch_add(1, std::memory_order_relaxed);
+    return Random::Generate(state.mKey.load(std::memory_order_relaxed), counter);
+}
+
+unsigned GetRandomNumber(unsigned min, unsigned max, RandomStream stream)
 {
-    static std::random_device random_device;
-    static std::mt19937 engine{random_device()};
-    std::uniform_int_distribution<> dist(min, max);
-    return dist(engine);
+    if (max < min)
+        return min;
+    const auto range = static_cast<std::uint64_t>(max - min) + 1;
+    return min + Random::Bounded(GetRandom32(stream), range);
 }
@@ -1,5 +1,83 @@
 #pragma once
 
-// Replace with something a bit better...
-unsigned GetRandomNumber(unsigned min, unsigned max);
+#include <cstdint>
+#include <limits>
 
+// Counter-based random numbers. Each stream's n'th number is a hash of
+// the seed, the stream and n, so a stream's sequence depends only on
+// the seed and how many numbers that stream has handed out. Subsystems
+// draw from their own stream so that using more random numbers in one
+// place doesn't change the results of another.
+enum class RandomStream : std::uint8_t
+{
+    General,
+    Dialog,
+    Haggle,
+    Skill,
+    Terrain,
+    NumStreams
+};
+
+// Resets every stream to the start of the sequence for this seed
+void SetRandomSeed(std::uint64_t seed);
+std::uint64_t GetRandomSeed();
+
+// Safe to call from multiple threads, though numbers are only
+// reproducible if each stream is used from a single thread
+std::uint32_t GetRandom32(RandomStream stream = RandomStream::General);
+
+// Uniform in [min, max], an empty range (max < min) gives min
+unsigned GetRandomNumber(
+    unsigned min,
+    unsigned max,
+    RandomStream stream = RandomStream::General);
+
+namespace Random {
+
+// SplitMix64 finalizer
+constexpr std::uint64_t Mix(std::uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+constexpr std::uint64_t sGamma = 0x9e3779b97f4a7c15ull;
+
+constexpr std::uint64_t StreamKey(std::uint64_t seed, RandomStream stream)
+{
+    return Mix(seed + sGamma * (static_cast<std::uint64_t>(stream) + 1));
+}
+
+constexpr std::uint32_t Generate(std::uint64_t key, std::uint64_t counter)
+{
+    return static_cast<std::uint32_t>(Mix(key + sGamma * counter) >> 32);
+}
+
+// Maps a uniform 32 bit number to [0, range) with a multiply and a
+// shift rather than a division and rejection loop. range may be up
+// to 2^32, the bias is at most range / 2^32, far below anything the
+// game can notice.
+constexpr std::uint32_t Bounded(std::uint32_t x, std::uint64_t range)
+{
+    return static_cast<std::uint32_t>((x * range) >> 32);
+}
+
+// Satisfies UniformRandomBitGenerator for use with std::shuffle etc.
+class Engine
+{
+public:
+    using result_type = std::uint32_t;
+
+    explicit Engine(RandomStream stream) : mStream{stream} {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() { return GetRandom32(mStream); }
+
+private:
+    RandomStream mStream;
+};
+
+}
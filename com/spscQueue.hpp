@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+// Fixed size lock free queue for handing items from exactly one
+// producer thread to exactly one consumer thread. Push fails rather
+// than blocking when the queue is full.
+template <typename T, std::size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity > 1 && (Capacity & (Capacity - 1)) == 0,
+        "Capacity must be a power of two");
+
+    // Keep the indices on separate cache lines so the producer and
+    // consumer don't invalidate each other's line on every operation
+    static constexpr std::size_t sCacheLine = 64;
+
+public:
+    SpscQueue()
+    :
+        mHead{0},
+        mTail{0},
+        mItems{}
+    {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // Producer only
+    bool Push(const T& item)
+    {
+        const auto tail = mTail.load(std::memory_order_relaxed);
+        if (tail - mHead.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        mItems[tail & (Capacity - 1)] = item;
+        mTail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only
+    std::optional<T> Pop()
+    {
+        const auto head = mHead.load(std::memory_order_relaxed);
+        if (head == mTail.load(std::memory_order_acquire))
+            return std::nullopt;
+
+        auto item = std::optional<T>{mItems[head & (Capacity - 1)]};
+        mHead.store(head + 1, std::memory_order_release);
+        return item;
+    }
+
+    bool Empty() const
+    {
+        return mHead.load(std::memory_order_acquire)
+            == mTail.load(std::memory_order_acquire);
+    }
+
+    static constexpr std::size_t GetCapacity() { return Capacity; }
+
+private:
+    alignas(sCacheLine) std::atomic<std::size_t> mHead;
+    alignas(sCacheLine) std::atomic<std::size_t> mTail;
+    alignas(sCacheLine) std::array<T, Capacity> mItems;
+};
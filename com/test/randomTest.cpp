@@ -0,0 +1,65 @@
+#include "gtest/gtest.h"
+
+#include "com/random.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace Random::Test {
+
+static std::vector<unsigned> Draw(RandomStream stream, unsigned count)
+{
+    auto result = std::vector<unsigned>{};
+    for (unsigned i = 0; i < count; i++)
+        result.emplace_back(GetRandomNumber(0, 99, stream));
+    return result;
+}
+
+TEST(RandomTest, SameSeedSameSequence)
+{
+    SetRandomSeed(42);
+    const auto first = Draw(RandomStream::Haggle, 16);
+    SetRandomSeed(42);
+    const auto second = Draw(RandomStream::Haggle, 16);
+    EXPECT_EQ(first, second);
+
+    SetRandomSeed(43);
+    EXPECT_NE(first, Draw(RandomStream::Haggle, 16));
+}
+
+TEST(RandomTest, StreamsAreIndependent)
+{
+    SetRandomSeed(7);
+    const auto expected = Draw(RandomStream::Skill, 16);
+
+    SetRandomSeed(7);
+    Draw(RandomStream::Dialog, 5);
+    GetRandom32(RandomStream::General);
+    EXPECT_EQ(Draw(RandomStream::Skill, 16), expected);
+}
+
+TEST(RandomTest, NumbersWithinBounds)
+{
+    SetRandomSeed(1);
+    for (unsigned i = 0; i < 1000; i++)
+    {
+        const auto n = GetRandomNumber(3, 5);
+        EXPECT_GE(n, 3u);
+        EXPECT_LE(n, 5u);
+    }
+
+    EXPECT_EQ(GetRandomNumber(9, 9), 9u);
+    // Empty range
+    EXPECT_EQ(GetRandomNumber(1, 0), 1u);
+    // Full range doesn't overflow
+    GetRandomNumber(0, 0xffffffff);
+}
+
+TEST(RandomTest, BoundedCoversRange)
+{
+    EXPECT_EQ(Bounded(0, 10), 0u);
+    EXPECT_EQ(Bounded(0xffffffff, 10), 9u);
+    EXPECT_EQ(Bounded(0xffffffff, 1ull << 32), 0xffffffffu);
+}
+
+}
@@ -0,0 +1,92 @@
+#include "gtest/gtest.h"
+
+#include "com/spscQueue.hpp"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+TEST(SpscQueueTest, StartsEmpty)
+{
+    auto queue = SpscQueue<unsigned, 4>{};
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.Pop(), std::nullopt);
+    EXPECT_EQ(queue.GetCapacity(), 4u);
+}
+
+TEST(SpscQueueTest, PushFailsWhenFull)
+{
+    auto queue = SpscQueue<unsigned, 4>{};
+    for (unsigned i = 0; i < 4; i++)
+        EXPECT_TRUE(queue.Push(i));
+    EXPECT_FALSE(queue.Push(4));
+    EXPECT_FALSE(queue.Empty());
+
+    // Making room lets the next push through
+    EXPECT_EQ(queue.Pop(), 0u);
+    EXPECT_TRUE(queue.Push(4));
+    EXPECT_FALSE(queue.Push(5));
+
+    for (unsigned i = 1; i < 5; i++)
+        EXPECT_EQ(queue.Pop(), i);
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(queue.Pop(), std::nullopt);
+}
+
+TEST(SpscQueueTest, WrapsAround)
+{
+    // Go round the buffer many times with the queue at different fill
+    // levels, so items are stored across the end of the array
+    auto queue = SpscQueue<unsigned, 4>{};
+    unsigned pushed = 0;
+    unsigned popped = 0;
+    for (unsigned round = 0; round < 50; round++)
+    {
+        const auto fill = 1 + round % (4 - (pushed - popped));
+        for (unsigned i = 0; i < fill; i++)
+            ASSERT_TRUE(queue.Push(pushed++));
+        const auto drain = 1 + (round * 3) % (pushed - popped);
+        for (unsigned i = 0; i < drain; i++)
+            ASSERT_EQ(queue.Pop(), popped++);
+    }
+
+    while (!queue.Empty())
+        EXPECT_EQ(queue.Pop(), popped++);
+    EXPECT_EQ(popped, pushed);
+}
+
+TEST(SpscQueueTest, ProducerConsumerOrdering)
+{
+    constexpr std::uint64_t sItems = 200000;
+    auto queue = SpscQueue<std::uint64_t, 64>{};
+
+    auto producer = std::thread{[&]{
+        for (std::uint64_t i = 0; i < sItems;)
+        {
+            if (queue.Push(i))
+                i++;
+            else
+                std::this_thread::yield();
+        }
+    }};
+
+    // Every item arrives once and in the order it was pushed
+    auto received = std::vector<std::uint64_t>{};
+    received.reserve(sItems);
+    while (received.size() < sItems)
+    {
+        if (const auto item = queue.Pop())
+            received.emplace_back(*item);
+        else
+            std::this_thread::yield();
+    }
+    producer.join();
+
+    EXPECT_TRUE(queue.Empty());
+    for (std::uint64_t i = 0; i < sItems; i++)
+        ASSERT_EQ(received[i], i);
+}
+
+}
@@ -0,0 +1,169 @@
+#pragma once
+
+#include "bak/camera.hpp"
+#include "bak/types.hpp"
+
+#include "com/assert.hpp"
+
+#include "game/benchmarkScript.hpp"
+#include "game/gameRunner.hpp"
+
+#include "gui/guiManager.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Game {
+
+// Scripted run through the game for reproducible performance numbers.
+// Flies the camera through a few tiles of the starting zone, opens
+// the common full screen GUIs, then transitions to other zones and
+// flies through those too. Frame times are kept per phase and
+// reported with load times as JSON.
+class Benchmark
+{
+    static constexpr auto sTilesPerZone = 4;
+    static constexpr auto sFramesPerTile = 90;
+    static constexpr auto sFramesPerScreen = 90;
+    static constexpr auto sCameraHeight = 100.0f;
+    static constexpr auto sExtraZones = 2;
+    static constexpr auto sZones = 12;
+
+public:
+    Benchmark(
+        Camera& camera,
+        Gui::GuiManager& guiManager,
+        GameRunner& gameRunner)
+    :
+        mCamera{camera},
+        mGuiManager{guiManager},
+        mGameRunner{gameRunner},
+        mScript{}
+    {
+        const auto startZone = mGameRunner.mZoneData->mZoneLabel.GetZoneNumber();
+
+        mScript.AddPhase("enter", [this]{ mGuiManager.EnterMainView(); }, [this](auto){
+            return GuiSettled(); });
+        AddFlyPhase(startZone);
+
+        if (mGameRunner.mGameState.mGameData)
+        {
+            AddScreenPhase("inventory",
+                [this]{ mGuiManager.ShowInventory(BAK::ActiveCharIndex{0}); },
+                [this]{ mGuiManager.ExitInventory(); });
+            AddScreenPhase("fullmap",
+                [this]{ mGuiManager.ShowFullMap(); },
+                [this]{ mGuiManager.DoFade(.8, [this]{ mGuiManager.ExitSimpleScreen(); }); });
+        }
+
+        for (unsigned i = 1; i <= sExtraZones; i++)
+        {
+            const auto zone = (startZone + i - 1) % sZones + 1;
+            mScript.AddPhase("load zone " + std::to_string(zone),
+                [this, zone]{ LoadZone(zone); },
+                [](auto){ return true; });
+            AddFlyPhase(zone);
+        }
+    }
+
+    Benchmark(const Benchmark&) = delete;
+    Benchmark& operator=(const Benchmark&) = delete;
+
+    void RecordLoad(std::string name, double seconds)
+    {
+        mScript.RecordLoad(std::move(name), seconds);
+    }
+
+    // Advance the script by one frame, false once it has finished
+    bool Update()
+    {
+        return mScript.Update();
+    }
+
+    // Frames in which a phase began, e.g. a zone load, aren't recorded
+    void FrameDone(double seconds)
+    {
+        mScript.FrameDone(seconds);
+    }
+
+    void WriteReport(std::ostream& os) const
+    {
+        mScript.WriteReport(os);
+    }
+
+private:
+    void AddFlyPhase(unsigned zone)
+    {
+        mScript.AddPhase("fly zone " + std::to_string(zone), []{}, [this](auto frame){
+            return FlyStep(frame); });
+    }
+
+    void AddScreenPhase(
+        std::string name,
+        std::function<void()>&& show,
+        std::function<void()>&& exit)
+    {
+        mScript.AddPhase(name, std::move(show), [this, exit=std::move(exit)](auto frame) mutable {
+            if (frame == sFramesPerScreen)
+                std::invoke(exit);
+            return frame > sFramesPerScreen && GuiSettled();
+        });
+    }
+
+    // No fades running and only the main view is displayed
+    bool GuiSettled() const
+    {
+        return !mGuiManager.IsAnimating()
+            && mGuiManager.mScreenStack.size() == 1
+            && mGuiManager.InMainView();
+    }
+
+    // Moves the camera along straight lines between tile centres
+    bool FlyStep(unsigned frame)
+    {
+        const auto& tiles = mGameRunner.mZoneData->mWorldTiles.GetTiles();
+        const auto tileCount = std::min<std::size_t>(sTilesPerZone, tiles.size());
+        if (tileCount < 2)
+            return true;
+
+        const auto segment = frame / sFramesPerTile;
+        if (segment + 1 >= tileCount)
+            return true;
+
+        auto from = tiles[segment].GetCenter();
+        auto to = tiles[segment + 1].GetCenter();
+        from.y = sCameraHeight;
+        to.y = sCameraHeight;
+
+        const auto t = static_cast<float>(frame % sFramesPerTile) / sFramesPerTile;
+        const auto direction = to - from;
+        mCamera.SetPosition(from + direction * t);
+        mCamera.SetAngle(glm::vec2{std::atan2(direction.x, direction.z), 0});
+        return false;
+    }
+
+    void LoadZone(unsigned zone)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        mGameRunner.DoTransition(zone, mCamera.GetGameLocation());
+        const auto end = std::chrono::steady_clock::now();
+        RecordLoad(
+            "zone " + std::to_string(zone),
+            std::chrono::duration<double>(end - start).count());
+    }
+
+    Camera& mCamera;
+    Gui::GuiManager& mGuiManager;
+    GameRunner& mGameRunner;
+
+    BenchmarkScript mScript;
+};
+
+}
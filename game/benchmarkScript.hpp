@@ -0,0 +1,177 @@
+#pragma once
+
+#include "com/logger.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Game {
+
+// Writes a JSON object with percentiles of the frame times. The
+// percentiles are null when there are no frames.
+inline void WriteFrameStats(
+    std::ostream& os,
+    const std::string& name,
+    std::vector<double> frameMs)
+{
+    os << "{\"name\": \"" << name << "\", \"frames\": " << frameMs.size();
+    if (frameMs.empty())
+    {
+        os << ", \"p50\": null, \"p95\": null, \"p99\": null, \"max\": null}";
+        return;
+    }
+
+    std::sort(frameMs.begin(), frameMs.end());
+    const auto Percentile = [&](double p) -> double
+    {
+        const auto rank = static_cast<std::size_t>(
+            std::ceil(p / 100.0 * frameMs.size()));
+        return frameMs[std::clamp<std::size_t>(rank, 1, frameMs.size()) - 1];
+    };
+
+    os << ", \"p50\": " << Percentile(50)
+        << ", \"p95\": " << Percentile(95)
+        << ", \"p99\": " << Percentile(99)
+        << ", \"max\": " << Percentile(100) << "}";
+}
+
+// Runs a list of phases a frame at a time and keeps the frame times
+// of each phase. A frame in which a phase began isn't recorded, so
+// one-off work like loading a zone doesn't count as a frame of the
+// phase that follows it.
+class BenchmarkScript
+{
+public:
+    struct Phase
+    {
+        std::string mName;
+        std::function<void()> mBegin;
+        // Called each frame with the frame number within the phase,
+        // returns true once the phase is finished
+        std::function<bool(unsigned)> mStep;
+    };
+
+    struct PhaseResult
+    {
+        std::string mName;
+        std::vector<double> mFrameMs;
+    };
+
+    struct LoadResult
+    {
+        std::string mName;
+        double mMs;
+    };
+
+    BenchmarkScript()
+    :
+        mPhases{},
+        mCurrentPhase{0},
+        mPhaseFrame{0},
+        mStarted{false},
+        mBeganPhase{false},
+        mResults{},
+        mLoads{},
+        mLogger{Logging::LogState::GetLogger("Game::BenchmarkScript")}
+    {}
+
+    void AddPhase(
+        std::string name,
+        std::function<void()>&& begin,
+        std::function<bool(unsigned)>&& step)
+    {
+        mPhases.emplace_back(Phase{std::move(name), std::move(begin), std::move(step)});
+    }
+
+    void RecordLoad(std::string name, double seconds)
+    {
+        mLogger.Info() << "Load " << name << " took " << seconds << "s\n";
+        mLoads.emplace_back(LoadResult{std::move(name), seconds * 1000.0});
+    }
+
+    // Advance the script by one frame, false once it has finished
+    bool Update()
+    {
+        mBeganPhase = false;
+        while (mCurrentPhase < mPhases.size())
+        {
+            auto& phase = mPhases[mCurrentPhase];
+            if (!mStarted)
+            {
+                mLogger.Info() << "Phase: " << phase.mName << "\n";
+                mResults.emplace_back(PhaseResult{phase.mName, {}});
+                std::invoke(phase.mBegin);
+                mStarted = true;
+                mBeganPhase = true;
+                mPhaseFrame = 0;
+            }
+
+            if (!std::invoke(phase.mStep, mPhaseFrame++))
+                return true;
+
+            mCurrentPhase++;
+            mStarted = false;
+        }
+        return false;
+    }
+
+    void FrameDone(double seconds)
+    {
+        if (mBeganPhase || mResults.empty())
+            return;
+        mResults.back().mFrameMs.emplace_back(seconds * 1000.0);
+    }
+
+    const std::vector<PhaseResult>& GetResults() const { return mResults; }
+    const std::vector<LoadResult>& GetLoads() const { return mLoads; }
+
+    void WriteReport(std::ostream& os) const
+    {
+        std::vector<double> all{};
+        for (const auto& result : mResults)
+            all.insert(all.end(), result.mFrameMs.begin(), result.mFrameMs.end());
+
+        os << std::fixed << std::setprecision(3);
+        os << "{\n  \"loads\": [";
+        for (unsigned i = 0; i < mLoads.size(); i++)
+        {
+            os << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << mLoads[i].mName
+                << "\", \"ms\": " << mLoads[i].mMs << "}";
+        }
+        os << "\n  ],\n  \"phases\": [";
+        bool first = true;
+        for (const auto& result : mResults)
+        {
+            // Phases like zone loads finish without drawing a frame,
+            // their time is in the loads
+            if (result.mFrameMs.empty())
+                continue;
+            os << (first ? "\n" : ",\n") << "    ";
+            WriteFrameStats(os, result.mName, result.mFrameMs);
+            first = false;
+        }
+        os << "\n  ],\n  \"overall\": ";
+        WriteFrameStats(os, "overall", all);
+        os << "\n}\n";
+    }
+
+private:
+    std::vector<Phase> mPhases;
+    std::size_t mCurrentPhase;
+    unsigned mPhaseFrame;
+    bool mStarted;
+    // A phase began during the current frame
+    bool mBeganPhase;
+
+    std::vector<PhaseResult> mResults;
+    std::vector<LoadResult> mLoads;
+
+    const Logging::Logger& mLogger;
+};
+
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "bak/types.hpp"
+
+#include "com/assert.hpp"
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace Game {
+
+// Sparse set of components keyed by entity. Components are packed
+// densely for iteration, mSparse maps an entity to its component's
+// position so add, remove and lookup are constant time. Removal swaps
+// the last component into the hole, so iteration order isn't stable
+// but entity ids are.
+template <typename T>
+class ComponentStore
+{
+    static constexpr auto sNoComponent = std::numeric_limits<unsigned>::max();
+
+public:
+    ComponentStore()
+    :
+        mComponents{},
+        mEntities{},
+        mSparse{}
+    {}
+
+    template <typename ...Args>
+    T& Emplace(BAK::EntityIndex entity, Args&&... args)
+    {
+        ASSERT(!Contains(entity));
+        if (entity.mValue >= mSparse.size())
+            mSparse.resize(entity.mValue + 1, sNoComponent);
+
+        mSparse[entity.mValue] = mComponents.size();
+        mEntities.emplace_back(entity);
+        return mComponents.emplace_back(std::forward<Args>(args)...);
+    }
+
+    bool Remove(BAK::EntityIndex entity)
+    {
+        if (!Contains(entity))
+            return false;
+
+        const auto index = mSparse[entity.mValue];
+        const auto last = mEntities.back();
+        if (index != mComponents.size() - 1)
+        {
+            mComponents[index] = std::move(mComponents.back());
+            mEntities[index] = last;
+            mSparse[last.mValue] = index;
+        }
+        mComponents.pop_back();
+        mEntities.pop_back();
+        mSparse[entity.mValue] = sNoComponent;
+        return true;
+    }
+
+    bool Contains(BAK::EntityIndex entity) const
+    {
+        return entity.mValue < mSparse.size()
+            && mSparse[entity.mValue] != sNoComponent;
+    }
+
+    T* Find(BAK::EntityIndex entity)
+    {
+        return Contains(entity) ? &mComponents[mSparse[entity.mValue]] : nullptr;
+    }
+
+    const T* Find(BAK::EntityIndex entity) const
+    {
+        return Contains(entity) ? &mComponents[mSparse[entity.mValue]] : nullptr;
+    }
+
+    void Clear()
+    {
+        mComponents.clear();
+        mEntities.clear();
+        mSparse.clear();
+    }
+
+    std::size_t size() const { return mComponents.size(); }
+    bool empty() const { return mComponents.empty(); }
+
+    auto begin() const { return mComponents.begin(); }
+    auto end() const { return mComponents.end(); }
+
+    // Packed components, mEntities[i] owns mComponents[i]
+    const std::vector<T>& GetComponents() const { return mComponents; }
+    const std::vector<BAK::EntityIndex>& GetEntities() const { return mEntities; }
+
+private:
+    std::vector<T> mComponents;
+    std::vector<BAK::EntityIndex> mEntities;
+    std::vector<unsigned> mSparse;
+};
+
+}
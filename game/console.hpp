@@ -85,9 +85,14 @@ struct Console : public std::streambuf
             return;
         }
 
-        const auto saved = mGameState->Save(words[1]);
+        const auto saved = mGameState->Save(words[1], [this, path=words[1]](bool success){
+            if (success)
+                AddLog("Game saved to: %s", path.c_str());
+            else
+                AddLog("[error] Failed to write save: %s", path.c_str());
+        });
         if (saved)
-            AddLog("Game saved to: %s", words[1].c_str());
+            AddLog("Saving game to: %s", words[1].c_str());
         else
             AddLog("Game not saved, no game data");
 
@@ -151,6 +156,61 @@ struct Console : public std::streambuf
         mGameRunner->LoadGame(words[1]);
     }
 
+    void TakeSnapshot(const std::vector<std::string>& words)
+    {
+        if (!mGameState)
+        {
+            AddLog("[error] QUICKSAVE FAILED No GameState Connected");
+            return;
+        }
+
+        const auto label = words.size() > 1 ? words[1] : std::string{"Quicksave"};
+        if (mGameState->TakeSnapshot(label))
+            AddLog("Snapshot taken: %s", label.c_str());
+        else
+            AddLog("Snapshot not taken, no game data");
+    }
+
+    void RestoreSnapshot(const std::vector<std::string>& words)
+    {
+        if (!mGameRunner)
+        {
+            AddLog("[error] QUICKLOAD FAILED No GameRunner Connected");
+            return;
+        }
+
+        unsigned age = 0;
+        if (words.size() > 1)
+        {
+            std::stringstream ss{};
+            ss << words[1];
+            ss >> age;
+        }
+
+        if (mGameRunner->RestoreSnapshot(age))
+            AddLog("Restored snapshot %d", age);
+        else
+            AddLog("[error] No snapshot %d", age);
+    }
+
+    void ShowSnapshots(const std::vector<std::string>&)
+    {
+        if (!mGameState)
+        {
+            AddLog("[error] SHOW_SNAPSHOTS FAILED No GameState Connected");
+            return;
+        }
+
+        const auto& snapshots = mGameState->GetSnapshots();
+        for (unsigned i = 0; i < snapshots.size(); i++)
+        {
+            const auto* snapshot = snapshots.Get(i);
+            std::stringstream ss{};
+            ss << i << " " << snapshot->mLabel << " " << snapshot->mTime;
+            AddLog(ss.str().c_str());
+        }
+    }
+
     void PlaySound(const std::vector<std::string>& words)
     {
         if (words.size() < 1)
@@ -389,6 +449,15 @@ struct Console : public std::streambuf
         mCommands.push_back("LOAD_GAME");
         mCommandActions.emplace_back([this](const auto& cmd){ LoadGame(cmd); });
 
+        mCommands.push_back("QUICKSAVE");
+        mCommandActions.emplace_back([this](const auto& cmd){ TakeSnapshot(cmd); });
+
+        mCommands.push_back("QUICKLOAD");
+        mCommandActions.emplace_back([this](const auto& cmd){ RestoreSnapshot(cmd); });
+
+        mCommands.push_back("SHOW_SNAPSHOTS");
+        mCommandActions.emplace_back([this](const auto& cmd){ ShowSnapshots(cmd); });
+
         mCommands.push_back("PLAY_SOUND");
         mCommandActions.emplace_back([this](const auto& cmd){ PlaySound(cmd); });
 
@@ -85,11 +85,28 @@ public:
 
     void LoadGame(std::string savePath) override
     {
+        // The save being loaded may still be queued for writing
+        BAK::SaveWriter::Get().Flush();
         mGameData = std::make_unique<BAK::GameData>(savePath);
         mGameState.LoadGameData(mGameData.get());
         LoadZoneData(mGameState.GetZone().mValue);
     }
 
+    // Rewind to an in-memory snapshot, only reloads the zone if it changed
+    bool RestoreSnapshot(unsigned age)
+    {
+        const auto zone = mGameState.GetZone();
+        if (!mGameState.RestoreSnapshot(age))
+            return false;
+
+        mGuiManager.EnterMainView();
+        if (zone != mGameState.GetZone())
+            LoadZoneData(mGameState.GetZone().mValue);
+        else
+            mCamera.SetGameLocation(mGameState.GetLocation());
+        return true;
+    }
+
     void LoadZoneData(unsigned zone)
     {
         mZoneData = std::make_unique<BAK::Zone>(zone);
@@ -114,8 +131,8 @@ public:
     void LoadSystems()
     {
         mSystems = std::make_unique<Systems>();
-        mEncounters.clear();
-        mClickables.clear();
+        mEncounters.Clear();
+        mClickables.Clear();
         mActiveEncounter = nullptr;
 
         for (const auto& world : mZoneData->mWorldTiles.GetTiles())
@@ -127,7 +144,7 @@ public:
                     auto id = mSystems->GetNextItemId();
                     auto renderable = Renderable{
                         id,
-                        mZoneData->mObjects.GetObject(item.GetZoneItem().GetName()),
+                        mZoneData->mObjects.GetObject(item.GetZoneItem().GetNameHandle()),
                         item.GetLocation(),
                         item.GetRotation(),
                         glm::vec3{static_cast<float>(item.GetZoneItem().GetScale())}};
@@ -143,7 +160,7 @@ public:
                             Clickable{
                                 id,
                                 item.GetLocation()});
-                        mClickables.emplace(id, &item);
+                        mClickables.Emplace(id, &item);
                         //mSystems->AddRenderable(
                         //    Renderable{
                         //        id,
@@ -191,7 +208,7 @@ public:
                                 Renderable{
                                     mSystems->GetNextItemId(),
                                     mZoneData->mObjects.GetObject(
-                                        monsters.GetMonsterAnimationFile(BAK::MonsterIndex{enemy.mMonster - 1u})),
+                                        monsters.GetMonsterAnimationHandle(BAK::MonsterIndex{enemy.mMonster - 1u})),
 
                                     BAK::ToGlCoord<float>(enemy.mLocation.mPosition),
                                     glm::vec3{0},
@@ -199,7 +216,7 @@ public:
                         }
                     });
 
-                mEncounters.emplace(id, &enc);
+                mEncounters.Emplace(id, &enc);
             }
         }
     }
@@ -397,11 +414,9 @@ public:
             BAK::ToGlCoord<float>(position));
         if (intersectable)
         {
-            auto it = mEncounters.find(*intersectable);
-            if (it != mEncounters.end())
+            if (const auto* encounter = mEncounters.Find(*intersectable))
             {
-                const auto* encounter = it->second;
-                mActiveEncounter = encounter;
+                mActiveEncounter = *encounter;
                 if (mActiveEncounter)
                     DoEncounter(*mActiveEncounter);
             }
@@ -415,12 +430,8 @@ public:
         auto intersectable = mSystems->RunIntersection(mCamera.GetPosition());
         if (intersectable)
         {
-            auto it = mEncounters.find(*intersectable);
-            if (it != mEncounters.end())
-            {
-                const auto* encounter = it->second;
-                mActiveEncounter = encounter;
-            }
+            if (const auto* encounter = mEncounters.Find(*intersectable))
+                mActiveEncounter = *encounter;
         }
 
         if (mActiveEncounter)
@@ -433,21 +444,15 @@ public:
     {
         assert(mSystems);
 
-        auto bestId = std::optional<BAK::EntityIndex>{};
-        for (const auto& entity : mSystems->GetClickables())
-        {
-            if (entity.GetId().mValue == entityId)
-            {
-                bestId = entity.GetId();
-                break;
-            }
-        }
+        const auto id = BAK::EntityIndex{entityId};
+        const auto* clickable = mClickables.Find(id);
         mLogger.Debug() << "Checked clickable entity id: " << entityId
-            << " found: " << bestId << "\n";
+            << " found: " << (clickable != nullptr) << "\n";
 
-        if (bestId)
+        if (clickable)
         {
-            mActiveClickable = mClickables[*bestId];
+            ASSERT(mSystems->FindClickable(id));
+            mActiveClickable = *clickable;
             const auto bakLocation = mActiveClickable->GetBakLocation();
             const auto et = mActiveClickable->GetZoneItem().GetEntityType();
 
@@ -494,8 +499,8 @@ public:
 
     const BAK::Encounter::Encounter* mActiveEncounter;
     const BAK::WorldItemInstance* mActiveClickable;
-    std::unordered_map<BAK::EntityIndex, const BAK::Encounter::Encounter*> mEncounters;
-    std::unordered_map<BAK::EntityIndex, const BAK::WorldItemInstance*> mClickables{};
+    ComponentStore<const BAK::Encounter::Encounter*> mEncounters;
+    ComponentStore<const BAK::WorldItemInstance*> mClickables;
     BAK::GenericContainer mNullContainer;
     std::unique_ptr<Systems> mSystems;
     glm::vec2 mSavedAngle;
@@ -14,6 +14,8 @@
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
 
+#include <utility>
+
 namespace Game::Interactable {
 
 class Building : public IInteractable
@@ -58,7 +60,7 @@ public:
 
         mGameState.SetDialogContext(2);
 
-        if (!CheckBitSet(mCurrentBuilding->GetDialog().mDialogOrder, 5))
+        if (!CheckBitSet(std::as_const(*mCurrentBuilding).GetDialog().mDialogOrder, 5))
         {
             // Skip dialog
             mState = State::SkipFirstDialog;
@@ -69,22 +71,22 @@ public:
         {
             mState = State::DoFirstDialog;
             Logging::LogDebug("Building") << "State: DoFirstDialog\n";
-            StartDialog(mCurrentBuilding->GetDialog().mDialog);
+            StartDialog(std::as_const(*mCurrentBuilding).GetDialog().mDialog);
         }
     }
 
     void LockFinished()
     {
-        ASSERT(!mCurrentBuilding->GetLock().IsFairyChest())
+        ASSERT(!std::as_const(*mCurrentBuilding).GetLock().IsFairyChest())
 
         if (mGuiManager.IsLockOpened())
         {
             // Unlockable buildings must always have a dialog
             ASSERT(mCurrentBuilding->HasDialog());
             mState = State::ShowInventory;
-            if (!CheckBitSet(mCurrentBuilding->GetDialog().mDialogOrder, 5))
+            if (!CheckBitSet(std::as_const(*mCurrentBuilding).GetDialog().mDialogOrder, 5))
             {
-                StartDialog(mCurrentBuilding->GetDialog().mDialog);
+                StartDialog(std::as_const(*mCurrentBuilding).GetDialog().mDialog);
             }
             else
             {
@@ -146,13 +148,13 @@ public:
     {
         if (mCurrentBuilding->HasEncounter()
         // Hack... probably there's a nicer way
-            && !mCurrentBuilding->GetEncounter().mHotspotRef)
+            && !std::as_const(*mCurrentBuilding).GetEncounter().mHotspotRef)
         {
             Logging::LogInfo("Building") << __FUNCTION__ << " " 
-                << mCurrentBuilding->GetEncounter() << "\n";
+                << std::as_const(*mCurrentBuilding).GetEncounter() << "\n";
             std::invoke(
                 mEncounterCallback,
-                *mCurrentBuilding->GetEncounter().mEncounterPos);
+                *std::as_const(*mCurrentBuilding).GetEncounter().mEncounterPos);
         }
         else
         {
@@ -171,8 +173,8 @@ public:
         else
         {
             mState = State::TryDoGDS;
-            if (!CheckBitSet(mCurrentBuilding->GetDialog().mDialogOrder, 5))
-                StartDialog(mCurrentBuilding->GetDialog().mDialog);
+            if (!CheckBitSet(std::as_const(*mCurrentBuilding).GetDialog().mDialogOrder, 5))
+                StartDialog(std::as_const(*mCurrentBuilding).GetDialog().mDialog);
             else
                 TryDoGDS();
 
@@ -183,13 +185,13 @@ public:
     {
         ASSERT(mState == State::TryDoGDS);
         if (mCurrentBuilding->HasEncounter()
-            && mCurrentBuilding->GetEncounter().mHotspotRef)
+            && std::as_const(*mCurrentBuilding).GetEncounter().mHotspotRef)
         {
             // Do GDS
             mState = State::Idle;
             mGuiManager.DoFade(.8, [this]{
                 mGuiManager.EnterGDSScene(
-                    *mCurrentBuilding->GetEncounter().mHotspotRef,
+                    *std::as_const(*mCurrentBuilding).GetEncounter().mHotspotRef,
                     []{});
                 });
         }
@@ -13,6 +13,8 @@
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
 
+#include <utility>
+
 namespace Game::Interactable {
 
 class Chest : public IInteractable
@@ -58,13 +60,13 @@ public:
             // If no lock, just open the box
             StartDialog(BAK::DialogSources::mOpenUnlockedBox);
         }
-        else if (chest.GetLock().IsFairyChest())
+        else if (std::as_const(chest).GetLock().IsFairyChest())
         {
             // If word lock, show flavour text then transition
             // into word lock screen
             StartDialog(BAK::DialogSources::mWordlockIntro);
         }
-        else if (!chest.GetLock().IsTrapped())
+        else if (!std::as_const(chest).GetLock().IsTrapped())
         {
             // If normal lock, ask if user wants to open lock
             StartDialog(BAK::DialogSources::mChooseUnlock);
@@ -72,15 +74,15 @@ public:
         else
         {
             // Scent of sarig aactive and chest is trapped
-            if (mGameState.GetSpellActive(5) && chest.GetLock().mLockFlag == 4)
+            if (mGameState.GetSpellActive(5) && std::as_const(chest).GetLock().mLockFlag == 4)
             {
                 // Box is trapped, do we want to open it?
                 StartDialog(BAK::DialogSources::mOpenTrappedBox);
             }
             // Chest is not trapped
-            else if (chest.GetLock().mLockFlag == 1)
+            else if (std::as_const(chest).GetLock().mLockFlag == 1)
             {
-                ASSERT(chest.GetLock().mLockFlag == 1);
+                ASSERT(std::as_const(chest).GetLock().mLockFlag == 1);
                 StartDialog(BAK::DialogSources::mOpenExplodedChest);
             }
             else
@@ -125,11 +127,11 @@ public:
             mState = State::Idle;
             ShowChestContents();
         }
-        else if (mCurrentChest->GetLock().IsFairyChest())
+        else if (std::as_const(*mCurrentChest).GetLock().IsFairyChest())
         {
             TryUnlockChest();
         }
-        else if (!mCurrentChest->GetLock().IsTrapped())
+        else if (!std::as_const(*mCurrentChest).GetLock().IsTrapped())
         {
             if (openChest)
                 TryUnlockChest();
@@ -140,7 +142,7 @@ public:
         {
             if (openChest)
             {
-                auto& lock = mCurrentChest->GetLock();
+                const auto& lock = std::as_const(*mCurrentChest).GetLock();
                 if (mGameState.GetSpellActive(5) && lock.mLockFlag == 4)
                 {
                     TryDisarmTrap();
@@ -207,10 +209,10 @@ public:
     void ShowChestContents()
     {
         if (mCurrentChest->HasEncounter()
-            && mCurrentChest->GetEncounter().mSetEventFlag != 0)
+            && std::as_const(*mCurrentChest).GetEncounter().mSetEventFlag != 0)
         {
             mGameState.SetEventValue(
-                mCurrentChest->GetEncounter().mSetEventFlag,
+                std::as_const(*mCurrentChest).GetEncounter().mSetEventFlag,
                 1);
         }
 
@@ -229,7 +231,7 @@ public:
     {
         ASSERT(mState == State::UnlockChest);
         mState = State::Idle;
-        if (mCurrentChest->GetLock().IsFairyChest())
+        if (std::as_const(*mCurrentChest).GetLock().IsFairyChest())
         {
             if (mGuiManager.IsWordLockOpened())
                 ShowChestContents();
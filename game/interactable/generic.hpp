@@ -12,6 +12,8 @@
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
 
+#include <utility>
+
 namespace Game::Interactable {
 
 /*
@@ -42,7 +44,7 @@ public:
         mContainer = &container;
 
         if (container.HasDialog())
-            StartDialog(container.GetDialog().mDialog);
+            StartDialog(std::as_const(container).GetDialog().mDialog);
         else if (container.HasEncounter())
             DoEncounter();
         else
@@ -53,7 +55,7 @@ public:
     {
         std::invoke(
             mEncounterCallback,
-            *mContainer->GetEncounter().mEncounterPos);
+            *std::as_const(*mContainer).GetEncounter().mEncounterPos);
     }
 
     void DialogFinished(const std::optional<BAK::ChoiceIndex>& choice)
@@ -12,6 +12,8 @@
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
 
+#include <utility>
+
 namespace Game::Interactable {
 
 class Ladder : public IInteractable
@@ -54,14 +56,14 @@ public:
 
     void LockFinished()
     {
-        ASSERT(!mCurrentLadder->GetLock().IsFairyChest())
+        ASSERT(!std::as_const(*mCurrentLadder).GetLock().IsFairyChest())
 
         if (mGuiManager.IsLockOpened())
         {
             // Unlockable ladders must always have a dialog
             ASSERT(mCurrentLadder->HasDialog());
             mState = State::Done;
-            StartDialog(mCurrentLadder->GetDialog().mDialog);
+            StartDialog(std::as_const(*mCurrentLadder).GetDialog().mDialog);
         }
         else
         {
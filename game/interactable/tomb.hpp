@@ -12,6 +12,8 @@
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
 
+#include <utility>
+
 namespace Game::Interactable {
 
 class Tomb : public IInteractable
@@ -50,7 +52,7 @@ public:
         // All tombs should have dialog
         ASSERT(mCurrentTomb->HasDialog());
 
-        StartDialog(mCurrentTomb->GetDialog().mDialog);
+        StartDialog(std::as_const(*mCurrentTomb).GetDialog().mDialog);
     }
 
     void DialogFinished(const std::optional<BAK::ChoiceIndex>& choice)
@@ -89,7 +91,7 @@ public:
 
     void DigTomb()
     {
-        const auto dialogOrder = mCurrentTomb->GetDialog().mDialogOrder;
+        const auto dialogOrder = std::as_const(*mCurrentTomb).GetDialog().mDialogOrder;
         mGameState.GetParty().RemoveItem(BAK::sShovel.mValue, 1);
 
         // Just show this dialog and do nothing else
@@ -119,10 +121,10 @@ public:
     void DoEncounter()
     {
         Logging::LogInfo("Tomb") << __FUNCTION__ << " " 
-            << mCurrentTomb->GetEncounter() << "\n";
+            << std::as_const(*mCurrentTomb).GetEncounter() << "\n";
         std::invoke(
             mEncounterCallback,
-            *mCurrentTomb->GetEncounter().mEncounterPos);
+            *std::as_const(*mCurrentTomb).GetEncounter().mEncounterPos);
     }
 
     void EncounterFinished() override
@@ -142,10 +144,10 @@ public:
     void ShowTombContents()
     {
         if (mCurrentTomb->HasEncounter()
-            && mCurrentTomb->GetEncounter().mSetEventFlag != 0)
+            && std::as_const(*mCurrentTomb).GetEncounter().mSetEventFlag != 0)
         {
             mGameState.SetEventValue(
-                mCurrentTomb->GetEncounter().mSetEventFlag,
+                std::as_const(*mCurrentTomb).GetEncounter().mSetEventFlag,
                 1);
         }
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "game/componentStore.hpp"
+
 #include "bak/constants.hpp"
 #include "bak/types.hpp"
 
@@ -160,7 +162,11 @@ public:
 
     Systems()
     :
-        mNextItemId{0}
+        mNextItemId{0},
+        mIntersectables{},
+        mRenderables{},
+        mSprites{},
+        mClickables{}
     {}
 
     BAK::EntityIndex GetNextItemId()
@@ -170,31 +176,32 @@ public:
 
     void AddIntersectable(const Intersectable& item)
     {
-        mIntersectables.emplace_back(item);
+        mIntersectables.Emplace(item.GetId(), item);
     }
 
     void AddClickable(const Clickable& item)
     {
-        mClickables.emplace_back(item);
+        mClickables.Emplace(item.GetId(), item);
     }
 
     void AddRenderable(const Renderable& item)
     {
-        mRenderables.emplace_back(item);
+        mRenderables.Emplace(item.GetId(), item);
     }
 
     void RemoveRenderable(BAK::EntityIndex i)
     {
-        auto it = std::find_if(
-            mRenderables.begin(), mRenderables.end(),
-            [i=i](const auto& r){ return r.GetId() == i; });
-        if (it != mRenderables.end())
-            mRenderables.erase(it);
+        mRenderables.Remove(i);
     }
 
     void AddSprite(const Renderable& item)
     {
-        mSprites.emplace_back(item);
+        mSprites.Emplace(item.GetId(), item);
+    }
+
+    const Clickable* FindClickable(BAK::EntityIndex i) const
+    {
+        return mClickables.Find(i);
     }
 
     std::optional<BAK::EntityIndex> RunIntersection(glm::vec3 cameraPos) const
@@ -208,16 +215,16 @@ public:
         return std::optional<BAK::EntityIndex>{};
     }
 
-    const std::vector<Intersectable>& GetIntersectables() const { return mIntersectables; }
-    const std::vector<Renderable>& GetRenderables() const { return mRenderables; }
-    const std::vector<Renderable>& GetSprites() const { return mSprites; }
-    const std::vector<Clickable>& GetClickables() const { return mClickables; }
+    const std::vector<Intersectable>& GetIntersectables() const { return mIntersectables.GetComponents(); }
+    const std::vector<Renderable>& GetRenderables() const { return mRenderables.GetComponents(); }
+    const std::vector<Renderable>& GetSprites() const { return mSprites.GetComponents(); }
+    const std::vector<Clickable>& GetClickables() const { return mClickables.GetComponents(); }
 
 private:
     unsigned mNextItemId;
 
-    std::vector<Intersectable> mIntersectables;
-    std::vector<Renderable> mRenderables;
-    std::vector<Renderable> mSprites;
-    std::vector<Clickable> mClickables;
+    Game::ComponentStore<Intersectable> mIntersectables;
+    Game::ComponentStore<Renderable> mRenderables;
+    Game::ComponentStore<Renderable> mSprites;
+    Game::ComponentStore<Clickable> mClickables;
 };
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+
+#include "game/benchmarkScript.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Game {
+
+TEST(BenchmarkScriptTest, FramesThatBeginAPhaseAreNotRecorded)
+{
+    auto script = BenchmarkScript{};
+    std::vector<std::string> begun{};
+    const auto Begin = [&](std::string name){
+        return [&begun, name]{ begun.emplace_back(name); }; };
+
+    script.AddPhase("fly a", Begin("fly a"), [](auto frame){ return frame == 3; });
+    // Like a zone load, finishes in the frame it begins
+    script.AddPhase("load", Begin("load"), [](auto){ return true; });
+    script.AddPhase("fly b", Begin("fly b"), [](auto frame){ return frame == 2; });
+
+    // Frame n takes n ms, frames 1 and 4 begin phases
+    double frameMs = 1;
+    while (script.Update())
+        script.FrameDone(frameMs++ / 1000.0);
+
+    EXPECT_EQ(begun, (std::vector<std::string>{"fly a", "load", "fly b"}));
+
+    const auto& results = script.GetResults();
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_EQ(results[0].mName, "fly a");
+    EXPECT_EQ(results[0].mFrameMs, (std::vector<double>{2, 3}));
+    EXPECT_EQ(results[1].mName, "load");
+    EXPECT_TRUE(results[1].mFrameMs.empty());
+    EXPECT_EQ(results[2].mName, "fly b");
+    EXPECT_EQ(results[2].mFrameMs, (std::vector<double>{5}));
+}
+
+TEST(BenchmarkScriptTest, ReportSkipsPhasesWithoutFrames)
+{
+    auto script = BenchmarkScript{};
+    script.AddPhase("load", []{}, [](auto){ return true; });
+    script.AddPhase("fly", []{}, [](auto frame){ return frame == 2; });
+    script.RecordLoad("zone 1", 0.5);
+    while (script.Update())
+        script.FrameDone(0.002);
+
+    auto report = std::stringstream{};
+    script.WriteReport(report);
+    const auto text = report.str();
+    EXPECT_EQ(text.find("\"name\": \"load\""), std::string::npos);
+    EXPECT_NE(text.find("{\"name\": \"zone 1\", \"ms\": 500.000}"), std::string::npos);
+    EXPECT_NE(text.find("{\"name\": \"fly\", \"frames\": 1, \"p50\": 2.000"), std::string::npos);
+}
+
+}
@@ -0,0 +1,93 @@
+#include "gtest/gtest.h"
+
+#include "game/componentStore.hpp"
+
+#include <string>
+#include <vector>
+
+namespace Game {
+
+struct ComponentStoreTestFixture : public ::testing::Test
+{
+    ComponentStoreTestFixture()
+    :
+        mStore{}
+    {
+        for (unsigned i = 0; i < 4; i++)
+            mStore.Emplace(BAK::EntityIndex{i * 2}, "c" + std::to_string(i * 2));
+    }
+
+    // Every packed component is found through its entity, and its
+    // entity is the one recorded next to it
+    void ExpectConsistent(const std::vector<unsigned>& entities)
+    {
+        ASSERT_EQ(mStore.size(), entities.size());
+        const auto& components = mStore.GetComponents();
+        for (unsigned i = 0; i < entities.size(); i++)
+        {
+            const auto entity = BAK::EntityIndex{entities[i]};
+            EXPECT_EQ(mStore.GetEntities()[i], entity);
+            EXPECT_TRUE(mStore.Contains(entity));
+            EXPECT_EQ(mStore.Find(entity), &components[i]);
+            EXPECT_EQ(components[i], "c" + std::to_string(entities[i]));
+        }
+    }
+
+    ComponentStore<std::string> mStore;
+};
+
+TEST_F(ComponentStoreTestFixture, Emplace)
+{
+    ExpectConsistent({0, 2, 4, 6});
+    EXPECT_FALSE(mStore.Contains(BAK::EntityIndex{1}));
+    EXPECT_FALSE(mStore.Contains(BAK::EntityIndex{100}));
+    EXPECT_EQ(mStore.Find(BAK::EntityIndex{3}), nullptr);
+}
+
+TEST_F(ComponentStoreTestFixture, RemoveMiddleSwapsInLast)
+{
+    EXPECT_TRUE(mStore.Remove(BAK::EntityIndex{2}));
+    EXPECT_FALSE(mStore.Contains(BAK::EntityIndex{2}));
+    EXPECT_EQ(mStore.Find(BAK::EntityIndex{2}), nullptr);
+    ExpectConsistent({0, 6, 4});
+}
+
+TEST_F(ComponentStoreTestFixture, RemoveLast)
+{
+    EXPECT_TRUE(mStore.Remove(BAK::EntityIndex{6}));
+    EXPECT_FALSE(mStore.Contains(BAK::EntityIndex{6}));
+    ExpectConsistent({0, 2, 4});
+}
+
+TEST_F(ComponentStoreTestFixture, RemoveMissing)
+{
+    EXPECT_FALSE(mStore.Remove(BAK::EntityIndex{3}));
+    EXPECT_FALSE(mStore.Remove(BAK::EntityIndex{100}));
+    EXPECT_TRUE(mStore.Remove(BAK::EntityIndex{4}));
+    EXPECT_FALSE(mStore.Remove(BAK::EntityIndex{4}));
+    ExpectConsistent({0, 2, 6});
+}
+
+TEST_F(ComponentStoreTestFixture, ReinsertAfterRemove)
+{
+    EXPECT_TRUE(mStore.Remove(BAK::EntityIndex{0}));
+    EXPECT_TRUE(mStore.Remove(BAK::EntityIndex{4}));
+    ExpectConsistent({6, 2});
+
+    mStore.Emplace(BAK::EntityIndex{4}, "c4");
+    mStore.Emplace(BAK::EntityIndex{0}, "c0");
+    ExpectConsistent({6, 2, 4, 0});
+}
+
+TEST_F(ComponentStoreTestFixture, RemoveAll)
+{
+    for (unsigned i = 0; i < 4; i++)
+        EXPECT_TRUE(mStore.Remove(BAK::EntityIndex{i * 2}));
+    EXPECT_TRUE(mStore.empty());
+    ExpectConsistent({});
+
+    mStore.Emplace(BAK::EntityIndex{2}, "c2");
+    ExpectConsistent({2});
+}
+
+}
@@ -0,0 +1,70 @@
+#include "graphics/frameScheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace Graphics {
+
+FrameScheduler::FrameScheduler(const FrameSchedulerConfig& config)
+:
+    mConfig{config},
+    mRedrawRequested{true},
+    mLastFrameTime{0},
+    mFramesDrawn{0},
+    mFramesSkipped{0},
+    mLogger{Logging::LogState::GetLogger("Graphics::FrameScheduler")}
+{
+    mLogger.Info() << "Target fps: " << mConfig.mTargetFps
+        << " on demand: " << mConfig.mOnDemand
+        << " idle fps: " << mConfig.mIdleFps << "\n";
+}
+
+bool FrameScheduler::IsIdle() const
+{
+    return mConfig.mOnDemand && !mRedrawRequested;
+}
+
+double FrameScheduler::GetIdleTimeout(double now) const
+{
+    if (mConfig.mIdleFps <= 0)
+        return 1.0;
+    const auto idleFrameDue = mLastFrameTime + 1.0 / mConfig.mIdleFps;
+    return std::max(idleFrameDue - now, 0.0);
+}
+
+void FrameScheduler::WaitForNextFrame(double now) const
+{
+    if (mConfig.mTargetFps <= 0)
+        return;
+
+    const auto remaining = mLastFrameTime + 1.0 / mConfig.mTargetFps - now;
+    if (remaining <= 0)
+        return;
+
+    // Sleeping overshoots by up to a scheduler tick, sleep short of
+    // the deadline and yield the rest of the way
+    using namespace std::chrono;
+    const auto deadline = steady_clock::now() + duration<double>{remaining};
+    constexpr auto sSpinMargin = milliseconds{1};
+    if (remaining > duration<double>{sSpinMargin}.count())
+        std::this_thread::sleep_until(deadline - sSpinMargin);
+    while (steady_clock::now() < deadline)
+        std::this_thread::yield();
+}
+
+bool FrameScheduler::ShouldDraw(double now) const
+{
+    if (!mConfig.mOnDemand || mRedrawRequested)
+        return true;
+    return GetIdleTimeout(now) <= 0;
+}
+
+void FrameScheduler::FrameDrawn(double now)
+{
+    mRedrawRequested = false;
+    mLastFrameTime = now;
+    mFramesDrawn++;
+}
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "com/logger.hpp"
+
+namespace Graphics {
+
+struct FrameSchedulerConfig
+{
+    // Frames per second to cap drawing at, 0 for uncapped
+    double mTargetFps;
+    // With on demand rendering frames are only drawn when something
+    // requested a redraw, or at mIdleFps to pick up anything missed
+    bool mOnDemand;
+    double mIdleFps;
+};
+
+// Decides when the main loop should draw a frame and sleeps between
+// frames so the loop doesn't spin a core faster than is useful.
+// Times are in seconds from whatever clock the caller uses.
+class FrameScheduler
+{
+public:
+    explicit FrameScheduler(const FrameSchedulerConfig& config);
+
+    // Something visible changed, draw the next frame
+    void RequestRedraw() { mRedrawRequested = true; }
+
+    // Nothing will be drawn until a redraw is requested or the idle
+    // frame is due, the caller may block waiting for input
+    bool IsIdle() const;
+    // Seconds until the next idle frame is due
+    double GetIdleTimeout(double now) const;
+
+    // Sleep until the next frame is due at the target frame rate
+    void WaitForNextFrame(double now) const;
+
+    bool ShouldDraw(double now) const;
+    void FrameDrawn(double now);
+
+    const FrameSchedulerConfig& GetConfig() const { return mConfig; }
+    unsigned GetFramesDrawn() const { return mFramesDrawn; }
+    unsigned GetFramesSkipped() const { return mFramesSkipped; }
+    void FrameSkipped() { mFramesSkipped++; }
+
+private:
+    FrameSchedulerConfig mConfig;
+    bool mRedrawRequested;
+    double mLastFrameTime;
+    unsigned mFramesDrawn;
+    unsigned mFramesSkipped;
+
+    const Logging::Logger& mLogger;
+};
+
+}
@@ -1,6 +1,8 @@
 #include "graphics/glfw.hpp"
 
 #include "com/logger.hpp"
+
+#include <cstdlib>
 #include <stdexcept>
 
 namespace Graphics {
@@ -38,11 +40,22 @@ void GLAPIENTRY OpenGlMessageCallback(
 std::unique_ptr<GLFWwindow, DestroyGlfwWindow> MakeGlfwWindow(
     unsigned height,
     unsigned width,
-    std::string_view title)
+    std::string_view title,
+    bool hidden)
 {
     const auto logger = Logging::LogState::GetLogger("GLFW");
     glfwSetErrorCallback([](int error, const char* desc){ puts(desc); });
 
+#ifdef GLFW_PLATFORM_NULL
+    const bool haveDisplay = std::getenv("DISPLAY") || std::getenv("WAYLAND_DISPLAY");
+    const bool useOsMesa = hidden && !haveDisplay;
+    if (useOsMesa)
+    {
+        logger.Info() << "No display, rendering with OSMesa" << std::endl;
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    }
+#endif
+
     if( !glfwInit() )
     {
         logger.Error() << "Failed to initialize GLFW" << std::endl;
@@ -56,6 +69,11 @@ std::unique_ptr<GLFWwindow, DestroyGlfwWindow> MakeGlfwWindow(
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, hidden ? GLFW_FALSE : GLFW_TRUE);
+#ifdef GLFW_PLATFORM_NULL
+    if (useOsMesa)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
 
     window = glfwCreateWindow(width, height, title.data(), nullptr, nullptr);
     if( window == nullptr)
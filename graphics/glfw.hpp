@@ -18,9 +18,13 @@ struct DestroyGlfwWindow
     }
 };
 
+// A hidden window renders offscreen, e.g. for benchmarking. With no
+// display available it falls back to an OSMesa context if GLFW
+// supports one.
 std::unique_ptr<GLFWwindow, DestroyGlfwWindow> MakeGlfwWindow(
     unsigned height,
     unsigned width,
-    std::string_view title);
+    std::string_view title,
+    bool hidden = false);
 
 }
@@ -1,5 +1,7 @@
 #include "graphics/guiRenderer.hpp"
 
+#include "graphics/profiler.hpp"
+
 #include "com/assert.hpp"
 
 #include <GL/glew.h>
@@ -190,6 +192,7 @@ void GuiRenderer::Draw(
         (void*) (offset * sizeof(GLuint)),
         offset
     );
+    Profiler::Get().CountDrawCall(length);
 }
 
 }
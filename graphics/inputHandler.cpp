@@ -1,5 +1,7 @@
 #include "graphics/inputHandler.hpp"
 
+#include "graphics/inputRecording.hpp"
+
 #include "com/assert.hpp"
 
 #include <functional>
@@ -9,6 +11,8 @@ namespace Graphics {
 InputHandler::InputHandler() noexcept
 :
     mHandleInput{true},
+    mInputReceived{false},
+    mRecorder{nullptr},
     mKeyBindings{},
     mCharacterCallback{},
     mMouseBindings{},
@@ -67,7 +71,7 @@ void InputHandler::HandleInput(GLFWwindow* window)
         {
             if (glfwGetKey(window, keyVal.first) == GLFW_PRESS)
             {
-                std::invoke(keyVal.second);
+                OnKeyHeld(keyVal.first);
             }
         }
     }
@@ -75,41 +79,53 @@ void InputHandler::HandleInput(GLFWwindow* window)
 
 void InputHandler::HandleMouseCallback(GLFWwindow* window, int button, int action, int mods)
 {
-    if (mHandleInput)
-    {
-        const auto it = mMouseBindings.find(button);
-        if (it != mMouseBindings.end())
-        {
-            if (action == GLFW_PRESS)
-            {
-                double pointerX, pointerY;
-                glfwGetCursorPos(window, &pointerX, &pointerY);
-                std::invoke(it->second.first, glm::vec2{pointerX, pointerY});
-            }
-            else if (action == GLFW_RELEASE)
-            {
-                double pointerX, pointerY;
-                glfwGetCursorPos(window, &pointerX, &pointerY);
-                std::invoke(it->second.second, glm::vec2{pointerX, pointerY});
-            }
-        }
-    }
+    double pointerX, pointerY;
+    glfwGetCursorPos(window, &pointerX, &pointerY);
+    OnMouseButton(button, action, glm::vec2{pointerX, pointerY});
 }
 
 void InputHandler::HandleMouseMotionCallback(GLFWwindow* window, double xpos, double ypos)
 {
-    if (mMouseMovedBinding)
-        std::invoke(mMouseMovedBinding, glm::vec2{xpos, ypos});
+    OnMouseMoved(glm::vec2{xpos, ypos});
 }
 
 void InputHandler::HandleMouseScrollCallback(GLFWwindow* window, double xpos, double ypos)
 {
-    if (mMouseScrolledBinding)
-        std::invoke(mMouseScrolledBinding, glm::vec2{xpos, ypos});
+    OnMouseScrolled(glm::vec2{xpos, ypos});
 }
 
 void InputHandler::HandleKeyboardCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    OnKey(key, action);
+}
+
+void InputHandler::HandleCharacterCallback(GLFWwindow* window, unsigned character)
+{
+    OnCharacter(character);
+}
+
+void InputHandler::OnKeyHeld(int key)
+{
+    mInputReceived = true;
+    if (mRecorder)
+        mRecorder->RecordKeyHeld(key);
+
+    if (mHandleInput)
+    {
+        const auto it = mKeyBindings.find(key);
+        if (it != mKeyBindings.end())
+        {
+            std::invoke(it->second);
+        }
+    }
+}
+
+void InputHandler::OnKey(int key, int action)
+{
+    mInputReceived = true;
+    if (mRecorder)
+        mRecorder->RecordKey(key, action);
+
     if (mHandleInput)
     {
         const auto it = mKeyBindings.find(key);
@@ -123,8 +139,12 @@ void InputHandler::HandleKeyboardCallback(GLFWwindow* window, int key, int scanc
     }
 }
 
-void InputHandler::HandleCharacterCallback(GLFWwindow* window, unsigned character)
+void InputHandler::OnCharacter(unsigned character)
 {
+    mInputReceived = true;
+    if (mRecorder)
+        mRecorder->RecordCharacter(character);
+
     if (mHandleInput)
     {
         if (mCharacterCallback)
@@ -134,6 +154,49 @@ void InputHandler::HandleCharacterCallback(GLFWwindow* window, unsigned characte
     }
 }
 
+void InputHandler::OnMouseButton(int button, int action, glm::vec2 position)
+{
+    mInputReceived = true;
+    if (mRecorder)
+        mRecorder->RecordMouseButton(button, action, position);
+
+    if (mHandleInput)
+    {
+        const auto it = mMouseBindings.find(button);
+        if (it != mMouseBindings.end())
+        {
+            if (action == GLFW_PRESS)
+            {
+                std::invoke(it->second.first, position);
+            }
+            else if (action == GLFW_RELEASE)
+            {
+                std::invoke(it->second.second, position);
+            }
+        }
+    }
+}
+
+void InputHandler::OnMouseMoved(glm::vec2 position)
+{
+    mInputReceived = true;
+    if (mRecorder)
+        mRecorder->RecordMouseMoved(position);
+
+    if (mMouseMovedBinding)
+        std::invoke(mMouseMovedBinding, position);
+}
+
+void InputHandler::OnMouseScrolled(glm::vec2 offset)
+{
+    mInputReceived = true;
+    if (mRecorder)
+        mRecorder->RecordMouseScrolled(offset);
+
+    if (mMouseScrolledBinding)
+        std::invoke(mMouseScrolledBinding, offset);
+}
+
 void InputHandler::HandleMouseInput(GLFWwindow* window)
 {
     
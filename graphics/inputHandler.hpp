@@ -9,6 +9,8 @@
 
 namespace Graphics {
 
+class InputRecorder;
+
 class InputHandler
 {
 public:
@@ -26,6 +28,20 @@ public:
         mHandleInput = value;
     }
 
+    // Whether any input arrived since the last call
+    bool ConsumeInputReceived()
+    {
+        const auto received = mInputReceived;
+        mInputReceived = false;
+        return received;
+    }
+
+    // Everything dispatched is also written to the recorder
+    void SetRecorder(InputRecorder* recorder)
+    {
+        mRecorder = recorder;
+    }
+
     void Bind(int key, KeyCallback&& callback);
     void BindCharacter(CharacterCallback&& callback);
     void BindMouse(
@@ -43,6 +59,15 @@ public:
     void HandleMouseMotionCallback(GLFWwindow* window, double xpos, double ypos);
     void HandleMouseScrollCallback(GLFWwindow* window, double xpos, double ypos);
 
+    // Dispatch input to the bindings. The GLFW callbacks go through
+    // these, replays call them directly.
+    void OnKeyHeld(int key);
+    void OnKey(int key, int action);
+    void OnCharacter(unsigned character);
+    void OnMouseButton(int button, int action, glm::vec2 position);
+    void OnMouseMoved(glm::vec2 position);
+    void OnMouseScrolled(glm::vec2 offset);
+
 private:
     static void MouseAction(GLFWwindow* window, int button, int action, int mods);
     static void MouseMotionAction(GLFWwindow* window, double xpos, double ypos);
@@ -53,6 +78,8 @@ private:
     static InputHandler* sHandler;
 
     bool mHandleInput;
+    bool mInputReceived;
+    InputRecorder* mRecorder;
 
     std::unordered_map<int, KeyCallback> mKeyBindings;
     CharacterCallback mCharacterCallback;
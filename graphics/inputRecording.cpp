@@ -0,0 +1,312 @@
+#include "graphics/inputRecording.hpp"
+
+#include "graphics/inputHandler.hpp"
+
+#include "com/assert.hpp"
+
+#include <bit>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace Graphics {
+
+namespace {
+
+static_assert(std::endian::native == std::endian::little,
+    "Input logs are read and written in host byte order");
+
+constexpr auto sMagic = std::string_view{"BAKI"};
+constexpr std::uint16_t sVersion = 1;
+constexpr std::size_t sFlushSize = 1 << 16;
+
+class LogReader
+{
+public:
+    explicit LogReader(std::vector<std::uint8_t>&& data)
+    :
+        mData{std::move(data)},
+        mOffset{0}
+    {}
+
+    template <typename T>
+    T Get()
+    {
+        Require(sizeof(T));
+        T value{};
+        std::memcpy(&value, mData.data() + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+        return value;
+    }
+
+    std::string GetString(std::size_t length)
+    {
+        Require(length);
+        auto value = std::string{
+            reinterpret_cast<const char*>(mData.data() + mOffset),
+            length};
+        mOffset += length;
+        return value;
+    }
+
+    bool AtEnd() const { return mOffset == mData.size(); }
+    std::size_t Tell() const { return mOffset; }
+
+private:
+    void Require(std::size_t bytes) const
+    {
+        if (mOffset + bytes > mData.size())
+        {
+            std::stringstream ss{};
+            ss << "Input log truncated at offset " << mOffset;
+            throw std::runtime_error(ss.str());
+        }
+    }
+
+    std::vector<std::uint8_t> mData;
+    std::size_t mOffset;
+};
+
+}
+
+InputRecorder::InputRecorder(
+    const std::filesystem::path& path,
+    std::uint64_t seed,
+    std::string_view start)
+:
+    mStream{path, std::ios::binary | std::ios::trunc},
+    mBuffer{},
+    mFrames{0},
+    mFinished{false},
+    mLogger{Logging::LogState::GetLogger("Graphics::InputRecorder")}
+{
+    if (!mStream)
+    {
+        std::stringstream ss{};
+        ss << "Failed to open input log for writing: " << path;
+        throw std::runtime_error(ss.str());
+    }
+
+    mBuffer.reserve(sFlushSize);
+    mBuffer.insert(mBuffer.end(), sMagic.begin(), sMagic.end());
+    Put(sVersion);
+    Put(seed);
+    ASSERT(start.size() <= 0xffff);
+    Put(static_cast<std::uint16_t>(start.size()));
+    mBuffer.insert(mBuffer.end(), start.begin(), start.end());
+
+    mLogger.Info() << "Recording input to " << path << "\n";
+}
+
+InputRecorder::~InputRecorder()
+{
+    if (!mFinished)
+        mLogger.Error() << "Input log was not finished, it can't be replayed\n";
+    Flush();
+}
+
+template <typename T>
+void InputRecorder::Put(T value)
+{
+    const auto* bytes = reinterpret_cast<const std::uint8_t*>(&value);
+    mBuffer.insert(mBuffer.end(), bytes, bytes + sizeof(T));
+}
+
+void InputRecorder::PutRecord(InputRecord record)
+{
+    ASSERT(!mFinished);
+    Put(static_cast<std::uint8_t>(record));
+}
+
+void InputRecorder::Flush()
+{
+    mStream.write(
+        reinterpret_cast<const char*>(mBuffer.data()),
+        mBuffer.size());
+    mStream.flush();
+    mBuffer.clear();
+}
+
+void InputRecorder::BeginFrame(double deltaTime)
+{
+    if (mBuffer.size() >= sFlushSize)
+        Flush();
+
+    PutRecord(InputRecord::Frame);
+    Put(deltaTime);
+    mFrames++;
+}
+
+void InputRecorder::RecordKeyHeld(int key)
+{
+    PutRecord(InputRecord::KeyHeld);
+    Put(static_cast<std::int16_t>(key));
+}
+
+void InputRecorder::RecordKey(int key, int action)
+{
+    PutRecord(InputRecord::Key);
+    Put(static_cast<std::int16_t>(key));
+    Put(static_cast<std::uint8_t>(action));
+}
+
+void InputRecorder::RecordCharacter(unsigned character)
+{
+    PutRecord(InputRecord::Character);
+    Put(static_cast<std::uint32_t>(character));
+}
+
+void InputRecorder::RecordMouseButton(int button, int action, glm::vec2 position)
+{
+    PutRecord(InputRecord::MouseButton);
+    Put(static_cast<std::uint8_t>(button));
+    Put(static_cast<std::uint8_t>(action));
+    Put(position.x);
+    Put(position.y);
+}
+
+void InputRecorder::RecordMouseMoved(glm::vec2 position)
+{
+    PutRecord(InputRecord::MouseMove);
+    Put(position.x);
+    Put(position.y);
+}
+
+void InputRecorder::RecordMouseScrolled(glm::vec2 offset)
+{
+    PutRecord(InputRecord::MouseScroll);
+    Put(offset.x);
+    Put(offset.y);
+}
+
+void InputRecorder::Finish(std::uint64_t stateHash)
+{
+    PutRecord(InputRecord::End);
+    Put(stateHash);
+    mFinished = true;
+    Flush();
+
+    mLogger.Info() << "Recorded " << mFrames << " frames, state hash: "
+        << std::hex << stateHash << std::dec << "\n";
+}
+
+InputReplay::InputReplay(const std::filesystem::path& path)
+:
+    mSeed{0},
+    mStart{},
+    mExpectedHash{},
+    mFrames{},
+    mCurrentFrame{0},
+    mLogger{Logging::LogState::GetLogger("Graphics::InputReplay")}
+{
+    auto stream = std::ifstream{path, std::ios::binary};
+    if (!stream)
+    {
+        std::stringstream ss{};
+        ss << "Failed to open input log: " << path;
+        throw std::runtime_error(ss.str());
+    }
+
+    auto reader = LogReader{std::vector<std::uint8_t>{
+        std::istreambuf_iterator<char>{stream},
+        std::istreambuf_iterator<char>{}}};
+
+    const auto magic = reader.GetString(sMagic.size());
+    const auto version = reader.Get<std::uint16_t>();
+    if (magic != sMagic || version != sVersion)
+    {
+        std::stringstream ss{};
+        ss << "Not a version " << sVersion << " input log: " << path;
+        throw std::runtime_error(ss.str());
+    }
+
+    mSeed = reader.Get<std::uint64_t>();
+    mStart = reader.GetString(reader.Get<std::uint16_t>());
+
+    while (!reader.AtEnd() && !mExpectedHash)
+    {
+        const auto record = static_cast<InputRecord>(reader.Get<std::uint8_t>());
+        if (record == InputRecord::Frame)
+        {
+            mFrames.emplace_back(Frame{reader.Get<double>(), {}});
+            continue;
+        }
+        else if (record == InputRecord::End)
+        {
+            mExpectedHash = reader.Get<std::uint64_t>();
+            continue;
+        }
+
+        if (mFrames.empty())
+            throw std::runtime_error("Input log has input before the first frame");
+
+        auto event = Event{record, 0, 0, glm::vec2{0}};
+        switch (record)
+        {
+        case InputRecord::KeyHeld:
+            event.mCode = reader.Get<std::int16_t>();
+            break;
+        case InputRecord::Key:
+            event.mCode = reader.Get<std::int16_t>();
+            event.mAction = reader.Get<std::uint8_t>();
+            break;
+        case InputRecord::Character:
+            event.mCode = reader.Get<std::uint32_t>();
+            break;
+        case InputRecord::MouseButton:
+            event.mCode = reader.Get<std::uint8_t>();
+            event.mAction = reader.Get<std::uint8_t>();
+            [[fallthrough]];
+        case InputRecord::MouseMove: [[fallthrough]];
+        case InputRecord::MouseScroll:
+            event.mPosition.x = reader.Get<float>();
+            event.mPosition.y = reader.Get<float>();
+            break;
+        default:
+            std::stringstream ss{};
+            ss << "Unknown input record " << static_cast<unsigned>(record)
+                << " at offset " << reader.Tell();
+            throw std::runtime_error(ss.str());
+        }
+        mFrames.back().mEvents.emplace_back(event);
+    }
+
+    if (!mExpectedHash)
+        mLogger.Error() << "Input log has no end, the session was cut short\n";
+
+    mLogger.Info() << "Loaded " << mFrames.size() << " frames from " << path << "\n";
+}
+
+std::optional<double> InputReplay::NextFrame()
+{
+    if (mCurrentFrame == mFrames.size())
+        return std::nullopt;
+    return mFrames[mCurrentFrame++].mDeltaTime;
+}
+
+void InputReplay::PlayFrame(InputHandler& handler) const
+{
+    ASSERT(mCurrentFrame > 0);
+    for (const auto& event : mFrames[mCurrentFrame - 1].mEvents)
+    {
+        switch (event.mRecord)
+        {
+        case InputRecord::KeyHeld:
+            handler.OnKeyHeld(event.mCode); break;
+        case InputRecord::Key:
+            handler.OnKey(event.mCode, event.mAction); break;
+        case InputRecord::Character:
+            handler.OnCharacter(event.mCode); break;
+        case InputRecord::MouseButton:
+            handler.OnMouseButton(event.mCode, event.mAction, event.mPosition); break;
+        case InputRecord::MouseMove:
+            handler.OnMouseMoved(event.mPosition); break;
+        case InputRecord::MouseScroll:
+            handler.OnMouseScrolled(event.mPosition); break;
+        default:
+            ASSERT(false);
+        }
+    }
+}
+
+}
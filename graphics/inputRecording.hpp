@@ -0,0 +1,120 @@
+#pragma once
+
+#include "com/logger.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Graphics {
+
+class InputHandler;
+
+// Binary input log layout, all values little endian:
+//   header: "BAKI", u16 version, u64 random seed, u16 length + start string
+//   then records of a u8 InputRecord followed by its payload, each frame
+//   starting with a Frame record and the log ending with End.
+enum class InputRecord : std::uint8_t
+{
+    Frame,       // f64 delta time
+    KeyHeld,     // i16 key
+    Key,         // i16 key, u8 action
+    Character,   // u32 character
+    MouseButton, // u8 button, u8 action, f32 x, f32 y
+    MouseMove,   // f32 x, f32 y
+    MouseScroll, // f32 x, f32 y
+    End          // u64 game state hash
+};
+
+// Writes the input dispatched by an InputHandler each frame so the
+// session can be replayed exactly
+class InputRecorder
+{
+public:
+    InputRecorder(
+        const std::filesystem::path& path,
+        std::uint64_t seed,
+        std::string_view start);
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    ~InputRecorder();
+
+    void BeginFrame(double deltaTime);
+
+    void RecordKeyHeld(int key);
+    void RecordKey(int key, int action);
+    void RecordCharacter(unsigned character);
+    void RecordMouseButton(int button, int action, glm::vec2 position);
+    void RecordMouseMoved(glm::vec2 position);
+    void RecordMouseScrolled(glm::vec2 offset);
+
+    // Ends the log with the hash the replay should arrive at
+    void Finish(std::uint64_t stateHash);
+
+    unsigned GetFrames() const { return mFrames; }
+
+private:
+    template <typename T>
+    void Put(T value);
+    void PutRecord(InputRecord record);
+    void Flush();
+
+    std::ofstream mStream;
+    std::vector<std::uint8_t> mBuffer;
+    unsigned mFrames;
+    bool mFinished;
+
+    const Logging::Logger& mLogger;
+};
+
+// Reads a log written by InputRecorder and feeds it back frame by
+// frame. Throws std::runtime_error when the log is malformed.
+class InputReplay
+{
+    struct Event
+    {
+        InputRecord mRecord;
+        int mCode;
+        int mAction;
+        glm::vec2 mPosition;
+    };
+
+    struct Frame
+    {
+        double mDeltaTime;
+        std::vector<Event> mEvents;
+    };
+
+public:
+    explicit InputReplay(const std::filesystem::path& path);
+
+    std::uint64_t GetSeed() const { return mSeed; }
+    const std::string& GetStart() const { return mStart; }
+    std::optional<std::uint64_t> GetExpectedHash() const { return mExpectedHash; }
+    std::size_t GetFrameCount() const { return mFrames.size(); }
+    std::size_t GetCurrentFrame() const { return mCurrentFrame; }
+
+    // Delta time of the next frame, or nothing once all have played
+    std::optional<double> NextFrame();
+    // Dispatch the current frame's input in the order it was recorded
+    void PlayFrame(InputHandler& handler) const;
+
+private:
+    std::uint64_t mSeed;
+    std::string mStart;
+    std::optional<std::uint64_t> mExpectedHash;
+    std::vector<Frame> mFrames;
+    std::size_t mCurrentFrame;
+
+    const Logging::Logger& mLogger;
+};
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "com/logger.hpp"
+#include "com/nameTable.hpp"
 
 #include "graphics/sphere.hpp"
 
@@ -9,8 +10,11 @@
 #include <glm/gtx/string_cast.hpp>
 
 #include <algorithm>
+#include <memory_resource>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
 #include <vector>
-#include <unordered_map>
 
 
 namespace Graphics {
@@ -60,15 +64,17 @@ class MeshObjectStorage
 public:
     using OffsetAndLength = std::pair<unsigned, unsigned>;
 
-    MeshObjectStorage()
+    explicit MeshObjectStorage(
+        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
     :
         mOffset{0},
-        mVertices{},
-        mNormals{},
-        mColors{},
-        mTextureCoords{},
-        mTextureBlends{},
-        mIndices{}
+        mObjects{resource},
+        mVertices{resource},
+        mNormals{resource},
+        mColors{resource},
+        mTextureCoords{resource},
+        mTextureBlends{resource},
+        mIndices{resource}
     {
     }
 
@@ -76,16 +82,25 @@ public:
         const std::string& id,
         const MeshObject& obj)
     {
-        if (mObjects.find(id) != mObjects.end())
+        return AddObject(InternName(id), obj);
+    }
+
+    OffsetAndLength AddObject(
+        NameHandle id,
+        const MeshObject& obj)
+    {
+        if (HasObject(id))
         {
-            mLog.Debug() << id << " already loaded" << std::endl;
-            return GetObject(id);
+            mLog.Debug() << GetInternedName(id) << " already loaded" << std::endl;
+            return *mObjects[id.mValue];
         }
 
         auto length = obj.GetNumVertices();
         const auto offsetAndLength = std::make_pair(mOffset, length);
 
-        mObjects.emplace(id, offsetAndLength);
+        if (id.mValue >= mObjects.size())
+            mObjects.resize(id.mValue + 1);
+        mObjects[id.mValue] = offsetAndLength;
 
         std::copy(obj.mVertices.begin(), obj.mVertices.end(), std::back_inserter(mVertices));
         std::copy(obj.mNormals.begin(), obj.mNormals.end(), std::back_inserter(mNormals));
@@ -94,7 +109,7 @@ public:
         std::copy(obj.mTextureBlends.begin(), obj.mTextureBlends.end(), std::back_inserter(mTextureBlends));
         std::copy(obj.mIndices.begin(), obj.mIndices.end(), std::back_inserter(mIndices));
 
-        mLog.Debug() << __FUNCTION__ << " " << id << " off: " << mOffset 
+        mLog.Debug() << __FUNCTION__ << " " << GetInternedName(id) << " off: " << mOffset 
             << " len: " << length << std::endl;
 
         mOffset += obj.GetNumVertices();
@@ -102,27 +117,82 @@ public:
         return offsetAndLength;
     }
 
-    OffsetAndLength GetObject(const std::string& id)
+    using NamedObject = std::pair<NameHandle, MeshObject>;
+
+    // Grows each buffer once for all the objects rather than once per
+    // object. With an arena every reallocation strands the old buffer,
+    // so adding a zone's objects one at a time would use about twice
+    // the memory the meshes need.
+    void AddObjects(const std::vector<NamedObject>& objects)
+    {
+        auto objectCount = mObjects.size();
+        for (const auto& [id, obj] : objects)
+            objectCount = std::max<std::size_t>(objectCount, id.mValue + 1);
+
+        // Only the first object with a name is added
+        auto counted = std::vector<bool>(objectCount);
+        std::size_t vertices = 0;
+        std::size_t indices = 0;
+        for (const auto& [id, obj] : objects)
+        {
+            if (HasObject(id) || counted[id.mValue])
+                continue;
+            counted[id.mValue] = true;
+            vertices += obj.GetNumVertices();
+            indices += obj.mIndices.size();
+        }
+
+        mObjects.resize(objectCount);
+        mVertices.reserve(mVertices.size() + vertices);
+        mNormals.reserve(mNormals.size() + vertices);
+        mColors.reserve(mColors.size() + vertices);
+        mTextureCoords.reserve(mTextureCoords.size() + vertices);
+        mTextureBlends.reserve(mTextureBlends.size() + vertices);
+        mIndices.reserve(mIndices.size() + indices);
+
+        for (const auto& [id, obj] : objects)
+            AddObject(id, obj);
+    }
+
+    OffsetAndLength GetObject(const std::string& id) const
     {   
-        if (mObjects.find(id) == mObjects.end())
+        const auto handle = FindName(id);
+        if (!handle || !HasObject(*handle))
         {
             std::stringstream ss{};
             ss << "Couldn't find: " << id;
             throw std::runtime_error(ss.str());
         }
-        return mObjects.find(id)->second;
+        return *mObjects[handle->mValue];
+    }
+
+    OffsetAndLength GetObject(NameHandle id) const
+    {
+        if (!HasObject(id))
+        {
+            std::stringstream ss{};
+            ss << "Couldn't find: " << GetInternedName(id);
+            throw std::runtime_error(ss.str());
+        }
+        return *mObjects[id.mValue];
+    }
+
+    bool HasObject(NameHandle id) const
+    {
+        return id.mValue < mObjects.size() && mObjects[id.mValue];
     }
 
 //private:
     unsigned long mOffset;
-    std::unordered_map<std::string, OffsetAndLength> mObjects;
-
-    std::vector<glm::vec3> mVertices;
-    std::vector<glm::vec3> mNormals;
-    std::vector<glm::vec4> mColors;
-    std::vector<glm::vec3> mTextureCoords;
-    std::vector<float> mTextureBlends;
-    std::vector<unsigned> mIndices;
+    // Indexed by NameHandle
+    std::pmr::vector<std::optional<OffsetAndLength>> mObjects;
+
+    std::pmr::vector<glm::vec3> mVertices;
+    std::pmr::vector<glm::vec3> mNormals;
+    std::pmr::vector<glm::vec4> mColors;
+    std::pmr::vector<glm::vec3> mTextureCoords;
+    std::pmr::vector<float> mTextureBlends;
+    std::pmr::vector<unsigned> mIndices;
 
     const Logging::Logger& mLog{
         Logging::LogState::GetLogger("MeshObjectStore")};
@@ -7,6 +7,7 @@
 
 #include <GL/glew.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace Graphics {
@@ -292,22 +293,26 @@ void TextureBuffer::LoadTexturesGL(
         1,              // levels
         GL_RGBA8,       // Internal format
         maxDim, maxDim, // width,height
-        sMaxTextures     // Number of layers
+        std::max<std::size_t>(textures.size(), 1) // Number of layers
     );
 
+    // Every layer is the same size, so reuse one staging buffer
+    std::vector<std::uint8_t> paddedTex(maxDim * maxDim * 4);
 
     unsigned index = 0;
     for (const auto& tex : textures)
     {
-        std::vector<glm::vec4> paddedTex(
-            maxDim * maxDim,
-            glm::vec4{0});
-
         // Chuck the image in the padded sized texture
-        // GetPixel() will wrap and fill the texture
-        for (unsigned x = 0; x < maxDim; x++)
-            for (unsigned y = 0; y < maxDim; y++)
-                paddedTex[x + y * maxDim] = tex.GetPixel(x, y);
+        // wrapping it so that GL_REPEAT tiles properly
+        const auto data = tex.GetRGBA8();
+        const auto width = tex.GetWidth();
+        const auto height = tex.GetHeight();
+        for (unsigned y = 0; y < maxDim; y++)
+            for (unsigned x = 0; x < maxDim; x++)
+                std::copy_n(
+                    data.begin() + ((x % width) + (y % height) * width) * 4,
+                    4,
+                    paddedTex.begin() + (x + y * maxDim) * 4);
 
         glTexSubImage3D(
             mTextureType,
@@ -315,7 +320,7 @@ void TextureBuffer::LoadTexturesGL(
             0, 0, index,       // xoffset, yoffset, zoffset
             maxDim, maxDim, 1, // width, height, depth
             GL_RGBA,           // format
-            GL_FLOAT,          // type
+            GL_UNSIGNED_BYTE,  // type
             paddedTex.data()); // pointer to data
 
         index++;
@@ -335,4 +340,49 @@ void TextureBuffer::LoadTexturesGL(
     UnbindGL();
 }
 
+void TextureBuffer::LoadAtlasGL(
+    const std::vector<Texture>& textures,
+    const TextureAtlas& atlas)
+{
+    if (atlas.GetLayerCount() > sMaxTextures)
+        throw std::runtime_error("Too many texture layers");
+
+    BindGL();
+
+    glTexStorage3D(
+        mTextureType,
+        1,
+        GL_RGBA8,
+        std::max(atlas.GetLayerWidth(), 1u),
+        std::max(atlas.GetLayerHeight(), 1u),
+        std::max(atlas.GetLayerCount(), 1u));
+
+    // Regions are uploaded as is, no staging copy needed
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    for (unsigned i = 0; i < textures.size(); i++)
+    {
+        const auto& region = atlas.GetRegion(i);
+        if (region.mWidth == 0 || region.mHeight == 0)
+            continue;
+
+        const auto data = textures[i].GetRGBA8();
+        glTexSubImage3D(
+            mTextureType,
+            0,
+            region.mX, region.mY, region.mLayer,
+            region.mWidth, region.mHeight, 1,
+            GL_RGBA,
+            GL_UNSIGNED_BYTE,
+            data.data());
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    glTexParameteri(mTextureType, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(mTextureType, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(mTextureType, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(mTextureType, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    UnbindGL();
+}
+
 }
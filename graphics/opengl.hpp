@@ -1,6 +1,7 @@
 #pragma once
 
 #include "graphics/texture.hpp"
+#include "graphics/textureAtlas.hpp"
 
 #include "com/logger.hpp"
 #include "com/strongType.hpp"
@@ -121,18 +122,18 @@ public:
     
     static GLBufferId GenBufferGL();
 
-    template <typename T>
+    template <typename T, typename Allocator>
     void LoadBufferDataGL(
         const std::string& name,
-        const std::vector<T>& data)
+        const std::vector<T, Allocator>& data)
     {
         LoadBufferDataGL(GetGLBuffer(name), data);
     }
 
-    template <typename T>
+    template <typename T, typename Allocator>
     void LoadBufferDataGL(
         const GLBuffer& buffer,
-        const std::vector<T>& data)
+        const std::vector<T, Allocator>& data)
     {
         glBindBuffer(
             ToGlEnum(buffer.mGLBindPoint),
@@ -201,10 +202,18 @@ public:
     void MakePickBuffer(unsigned width, unsigned height);
     void MakeTexture2DArray();
 
+    // Each texture gets its own maxDim square layer, wrapped to fill it
+    // so that it can be tiled with GL_REPEAT
     void LoadTexturesGL(
         const std::vector<Texture>& textures,
         unsigned maxDim);
 
+    // Textures are placed at their atlas regions, for sprites that are
+    // never tiled
+    void LoadAtlasGL(
+        const std::vector<Texture>& textures,
+        const TextureAtlas& atlas);
+
 //private:
     GLuint mTextureBuffer;
     GLenum mTextureType;
@@ -0,0 +1,252 @@
+#include "graphics/profiler.hpp"
+
+#include "com/assert.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+namespace Graphics {
+
+Profiler& Profiler::Get()
+{
+    static Profiler profiler{};
+    return profiler;
+}
+
+Profiler::Profiler()
+:
+    mEnabled{false},
+    mFrame{0},
+    mEpoch{Clock::now()},
+    mFrameStart{mEpoch},
+    mFrameHistory{},
+    mFrameStartAllocations{},
+    mLastFrameAllocations{},
+    mPasses{},
+    mActive{},
+    mTracePath{},
+    mCaptureFrames{0},
+    mTrace{},
+    mLogger{Logging::LogState::GetLogger("Graphics::Profiler")}
+{}
+
+double Profiler::Now() const
+{
+    return std::chrono::duration<double, std::micro>(
+        Clock::now() - mEpoch).count();
+}
+
+void Profiler::BeginFrame()
+{
+    if (!mEnabled)
+        return;
+
+    mFrameStart = Clock::now();
+    mFrameStartAllocations = Allocations::GetThreadCounts();
+    for (auto& pass : mPasses)
+    {
+        pass.mCpuMs = 0;
+        pass.mCounters = PassCounters{};
+        pass.mQueryIssuedThisFrame = false;
+    }
+}
+
+void Profiler::EndFrame()
+{
+    if (!mEnabled)
+        return;
+
+    ASSERT(mActive.empty());
+
+    const auto slot = mFrame % sHistory;
+    mFrameHistory[slot] = std::chrono::duration<float, std::milli>(
+        Clock::now() - mFrameStart).count();
+    mLastFrameAllocations = Allocations::GetThreadCounts() - mFrameStartAllocations;
+
+    for (std::size_t i = 0; i < mPasses.size(); i++)
+    {
+        auto& pass = mPasses[i];
+        pass.mCpuHistory[slot] = pass.mCpuMs;
+        pass.mLastCounters = pass.mCounters;
+        if (pass.mGpu)
+            ReadQueries(pass, i);
+    }
+
+    mFrame++;
+
+    if (mCaptureFrames > 0 && --mCaptureFrames == 0)
+        WriteTrace();
+}
+
+void Profiler::BeginPass(std::string_view name, bool gpu)
+{
+    if (!mEnabled)
+        return;
+
+    auto it = std::find_if(mPasses.begin(), mPasses.end(),
+        [&](const auto& pass){ return pass.mName == name; });
+    if (it == mPasses.end())
+    {
+        mPasses.emplace_back(Pass{
+            .mName = std::string{name},
+            .mGpu = gpu,
+            .mStart = {},
+            .mStartAllocations = {},
+            .mCpuMs = 0,
+            .mCounters = {},
+            .mCpuHistory = {},
+            .mGpuHistory = {},
+            .mLastCounters = {},
+            .mQueries = {},
+            .mQueryIssued = {},
+            .mQueryActive = false,
+            .mQueryIssuedThisFrame = false});
+        if (gpu)
+            glGenQueries(sQueryLatency, mPasses.back().mQueries.data());
+        it = std::prev(mPasses.end());
+    }
+
+    auto& pass = *it;
+    const auto index = std::distance(mPasses.begin(), it);
+    mActive.emplace_back(index);
+    pass.mStart = Clock::now();
+    pass.mStartAllocations = Allocations::GetThreadCounts();
+
+    // GL_TIME_ELAPSED queries can't nest or repeat within a frame,
+    // later instances are only timed on the CPU
+    const bool gpuPassRunning = std::any_of(mActive.begin(), mActive.end(),
+        [&](auto i){ return mPasses[i].mQueryActive; });
+    const auto query = mFrame % sQueryLatency;
+    if (pass.mGpu
+        && !gpuPassRunning
+        && !pass.mQueryIssuedThisFrame
+        && !pass.mQueryIssued[query])
+    {
+        glBeginQuery(GL_TIME_ELAPSED, pass.mQueries[query]);
+        pass.mQueryIssued[query] = Now();
+        pass.mQueryActive = true;
+        pass.mQueryIssuedThisFrame = true;
+    }
+}
+
+void Profiler::EndPass()
+{
+    if (!mEnabled)
+        return;
+
+    ASSERT(!mActive.empty());
+    auto& pass = mPasses[mActive.back()];
+    const auto passIndex = mActive.back();
+    mActive.pop_back();
+
+    if (pass.mQueryActive)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        pass.mQueryActive = false;
+    }
+
+    const auto end = Clock::now();
+    pass.mCpuMs += std::chrono::duration<double, std::milli>(
+        end - pass.mStart).count();
+    const auto allocations = Allocations::GetThreadCounts() - pass.mStartAllocations;
+    pass.mCounters.mAllocations += allocations.mAllocations;
+    pass.mCounters.mAllocatedBytes += allocations.mBytes;
+
+    if (mCaptureFrames > 0)
+    {
+        const auto startUs = std::chrono::duration<double, std::micro>(
+            pass.mStart - mEpoch).count();
+        const auto endUs = std::chrono::duration<double, std::micro>(
+            end - mEpoch).count();
+        mTrace.emplace_back(TraceEvent{
+            passIndex, false, startUs, endUs - startUs, pass.mCounters});
+    }
+}
+
+void Profiler::ReadQueries(Pass& pass, std::size_t passIndex)
+{
+    const auto slot = mFrame % sHistory;
+    pass.mGpuHistory[slot] = pass.mGpuHistory[(slot + sHistory - 1) % sHistory];
+
+    // Read whichever queries have finished, the rest are polled again
+    // next frame
+    for (std::size_t q = 0; q < sQueryLatency; q++)
+    {
+        if (!pass.mQueryIssued[q])
+            continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(pass.mQueries[q], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            continue;
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(pass.mQueries[q], GL_QUERY_RESULT, &elapsedNs);
+        const auto elapsedMs = static_cast<double>(elapsedNs) / 1e6;
+        pass.mGpuHistory[slot] = elapsedMs;
+
+        // The GPU doesn't report when it started, show the work on
+        // the GPU track starting when the CPU issued it
+        if (mCaptureFrames > 0)
+        {
+            mTrace.emplace_back(TraceEvent{
+                passIndex, true, *pass.mQueryIssued[q], elapsedMs * 1000, PassCounters{}});
+        }
+
+        pass.mQueryIssued[q].reset();
+    }
+}
+
+float Profiler::Average(const std::array<float, sHistory>& history)
+{
+    return std::accumulate(history.begin(), history.end(), 0.0f) / history.size();
+}
+
+void Profiler::CaptureTrace(std::filesystem::path path, unsigned frames)
+{
+    mLogger.Info() << "Capturing " << frames << " frames to " << path << "\n";
+    mTracePath = std::move(path);
+    mCaptureFrames = frames;
+    mTrace.clear();
+}
+
+void Profiler::WriteTrace() const
+{
+    auto out = std::ofstream{mTracePath};
+    if (!out)
+    {
+        mLogger.Error() << "Failed to open trace file: " << mTracePath << "\n";
+        return;
+    }
+
+    constexpr auto sCpuThread = 0;
+    constexpr auto sGpuThread = 1;
+
+    out << "{\"traceEvents\":[\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << sCpuThread
+        << ",\"args\":{\"name\":\"CPU\"}},\n";
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << sGpuThread
+        << ",\"args\":{\"name\":\"GPU\"}}";
+    for (const auto& event : mTrace)
+    {
+        out << ",\n{\"name\":\"" << mPasses[event.mPass].mName
+            << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << (event.mGpu ? sGpuThread : sCpuThread)
+            << ",\"ts\":" << event.mStartUs
+            << ",\"dur\":" << event.mDurationUs;
+        if (!event.mGpu)
+        {
+            out << ",\"args\":{\"drawCalls\":" << event.mCounters.mDrawCalls
+                << ",\"triangles\":" << event.mCounters.mTriangles
+                << ",\"uniforms\":" << event.mCounters.mUniformUploads
+                << ",\"allocations\":" << event.mCounters.mAllocations
+                << ",\"allocatedBytes\":" << event.mCounters.mAllocatedBytes << "}";
+        }
+        out << "}";
+    }
+    out << "\n]}\n";
+
+    mLogger.Info() << "Wrote " << mTrace.size() << " trace events to " << mTracePath << "\n";
+}
+
+}
@@ -0,0 +1,161 @@
+#pragma once
+
+#include "com/allocationTracker.hpp"
+#include "com/logger.hpp"
+
+#include <GL/glew.h>
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Graphics {
+
+struct PassCounters
+{
+    unsigned mDrawCalls;
+    unsigned mTriangles;
+    unsigned mUniformUploads;
+    // Heap allocations on the main thread, including those of nested
+    // passes. Always zero without BAK_TRACK_ALLOCATIONS.
+    std::uint64_t mAllocations;
+    std::uint64_t mAllocatedBytes;
+};
+
+// Measures where frame time goes. Passes are named sections of the
+// frame timed on the CPU and, for passes that issue GL work, on the
+// GPU with GL_TIME_ELAPSED queries. Draw calls, triangles and
+// uniform uploads are attributed to the innermost running pass.
+// Allocations are counted for the frame as a whole and for each pass.
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // Frames of history kept for averages and plots
+    static constexpr std::size_t sHistory = 120;
+    // Queries in flight per pass. Every frame each issued query is
+    // polled and read once its result is available, so reading never
+    // stalls the pipeline. A pass isn't timed on the GPU in a frame
+    // whose query slot is still waiting on a result.
+    static constexpr std::size_t sQueryLatency = 3;
+
+    struct Pass
+    {
+        std::string mName;
+        bool mGpu;
+
+        Clock::time_point mStart;
+        Allocations::AllocationCounts mStartAllocations;
+        double mCpuMs;
+        PassCounters mCounters;
+
+        std::array<float, sHistory> mCpuHistory;
+        std::array<float, sHistory> mGpuHistory;
+        PassCounters mLastCounters;
+
+        std::array<GLuint, sQueryLatency> mQueries;
+        // Trace timestamp of the CPU side of each query's pass
+        std::array<std::optional<double>, sQueryLatency> mQueryIssued;
+        bool mQueryActive;
+        bool mQueryIssuedThisFrame;
+    };
+
+    static Profiler& Get();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    void SetEnabled(bool enabled) { mEnabled = enabled; }
+    bool IsEnabled() const { return mEnabled; }
+
+    void BeginFrame();
+    void EndFrame();
+
+    void BeginPass(std::string_view name, bool gpu);
+    void EndPass();
+
+    void CountDrawCall(unsigned indices)
+    {
+        if (mEnabled && !mActive.empty())
+        {
+            auto& counters = mPasses[mActive.back()].mCounters;
+            counters.mDrawCalls++;
+            counters.mTriangles += indices / 3;
+        }
+    }
+
+    void CountUniformUpload()
+    {
+        if (mEnabled && !mActive.empty())
+            mPasses[mActive.back()].mCounters.mUniformUploads++;
+    }
+
+    const std::vector<Pass>& GetPasses() const { return mPasses; }
+    const std::array<float, sHistory>& GetFrameHistory() const { return mFrameHistory; }
+    std::size_t GetHistoryOffset() const { return mFrame % sHistory; }
+    const Allocations::AllocationCounts& GetLastFrameAllocations() const { return mLastFrameAllocations; }
+    static float Average(const std::array<float, sHistory>&);
+
+    // Record the next frames as Chrome trace events (chrome://tracing
+    // or Perfetto) and write them to path once they are done
+    void CaptureTrace(std::filesystem::path path, unsigned frames);
+    bool IsCapturing() const { return mCaptureFrames > 0; }
+
+private:
+    Profiler();
+
+    struct TraceEvent
+    {
+        std::size_t mPass;
+        bool mGpu;
+        double mStartUs;
+        double mDurationUs;
+        PassCounters mCounters;
+    };
+
+    double Now() const;
+    void ReadQueries(Pass& pass, std::size_t passIndex);
+    void WriteTrace() const;
+
+    bool mEnabled;
+    std::size_t mFrame;
+    Clock::time_point mEpoch;
+    Clock::time_point mFrameStart;
+    std::array<float, sHistory> mFrameHistory;
+    Allocations::AllocationCounts mFrameStartAllocations;
+    Allocations::AllocationCounts mLastFrameAllocations;
+
+    std::vector<Pass> mPasses;
+    std::vector<std::size_t> mActive;
+
+    std::filesystem::path mTracePath;
+    unsigned mCaptureFrames;
+    std::vector<TraceEvent> mTrace;
+
+    const Logging::Logger& mLogger;
+};
+
+// Times the enclosing scope as the named pass
+class ProfileScope
+{
+public:
+    ProfileScope(std::string_view name, bool gpu)
+    {
+        Profiler::Get().BeginPass(name, gpu);
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+    ~ProfileScope()
+    {
+        Profiler::Get().EndPass();
+    }
+};
+
+}
@@ -53,6 +53,30 @@ public:
             {0, 1, 2, 3, 4, 5}}
     {}
 
+    // Unit quad sampling the given region of a texture layer
+    Quad(
+        glm::vec2 minUV,
+        glm::vec2 maxUV,
+        unsigned textureIndex)
+    :
+        Quad{
+            std::vector<glm::vec3>{
+                {0, 1, 0},
+                {0, 0, 0},
+                {1, 0, 0},
+                {0, 1, 0},
+                {1, 0, 0},
+                {1, 1, 0}},
+            std::vector<glm::vec3>{
+                {minUV.x, minUV.y, textureIndex},
+                {minUV.x, maxUV.y, textureIndex},
+                {maxUV.x, maxUV.y, textureIndex},
+                {minUV.x, minUV.y, textureIndex},
+                {maxUV.x, maxUV.y, textureIndex},
+                {maxUV.x, minUV.y, textureIndex}},
+            {0, 1, 2, 3, 4, 5}}
+    {}
+
     Quad(
         std::vector<glm::vec3> vertices,
         std::vector<glm::vec3> textureCoords,
@@ -3,6 +3,7 @@
 #include "graphics/meshObject.hpp"
 #include "graphics/opengl.hpp"
 #include "graphics/framebuffer.hpp"
+#include "graphics/profiler.hpp"
 #include "graphics/shaderProgram.hpp"
 
 namespace Graphics {
@@ -159,6 +160,7 @@ public:
                 (void*) (offset * sizeof(GLuint)),
                 offset
             );
+            Profiler::Get().CountDrawCall(length);
         };
 
         for (const auto& item : renderables)
@@ -236,6 +238,7 @@ public:
                 (void*) (offset * sizeof(GLuint)),
                 offset
             );
+            Profiler::Get().CountDrawCall(length);
         }
     }
 
@@ -323,6 +326,7 @@ public:
                 (void*) (offset * sizeof(GLuint)),
                 offset
             );
+            Profiler::Get().CountDrawCall(length);
         }
     }
 
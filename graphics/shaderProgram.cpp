@@ -1,5 +1,7 @@
 #include "graphics/shaderProgram.hpp"
 
+#include "graphics/profiler.hpp"
+
 #include "com/path.hpp"
 
 #include <glm/gtc/type_ptr.hpp>
@@ -60,30 +62,36 @@ void ShaderProgramHandle::UseProgramGL() const
 
 void ShaderProgramHandle::SetUniform(GLuint id, const glm::mat4& value)
 {
+    Graphics::Profiler::Get().CountUniformUpload();
     glUniformMatrix4fv(id, 1, GL_FALSE, glm::value_ptr(value));
 }
 
 void ShaderProgramHandle::SetUniform(GLuint id, int value)
 {
+    Graphics::Profiler::Get().CountUniformUpload();
     glUniform1i(id, value);
 }
 
 void ShaderProgramHandle::SetUniform(GLuint id, unsigned value)
 {
+    Graphics::Profiler::Get().CountUniformUpload();
     glUniform1ui(id, value);
 }
 
 void ShaderProgramHandle::SetUniform(GLuint id, Float value)
 {
+    Graphics::Profiler::Get().CountUniformUpload();
     glUniform1f(id, value.mValue);
 }
 void ShaderProgramHandle::SetUniform(GLuint id, const glm::vec3& value)
 {
+    Graphics::Profiler::Get().CountUniformUpload();
     glUniform3f(id, value.x, value.y, value.z);
 }
 
 void ShaderProgramHandle::SetUniform(GLuint id, const glm::vec4& value)
 {
+    Graphics::Profiler::Get().CountUniformUpload();
     glUniform4f(id, value.r, value.g, value.b, value.a);
 }
 
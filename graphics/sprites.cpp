@@ -1,5 +1,7 @@
 #include "graphics/sprites.hpp"
 
+#include "graphics/textureAtlas.hpp"
+
 #include "com/assert.hpp"
 
 #include <GL/glew.h>
@@ -57,23 +59,25 @@ void Sprites::UnbindGL() const
 
 void Sprites::LoadTexturesGL(const TextureStore& textures)
 {
-    mTextureBuffer.LoadTexturesGL(
-        textures.GetTextures(),
-        textures.GetMaxDim());
+    const auto atlas = TextureAtlas{textures.GetTextures()};
+    mTextureBuffer.LoadAtlasGL(textures.GetTextures(), atlas);
 
     // Normal quad for use as arbitrary rectangle
     mObjects.AddObject(Quad{1.0, 1.0, 1.0, 0});
     // This is why mNonSpriteObjects = 1;
 
+    const auto layerDims = glm::vec2{
+        atlas.GetLayerWidth(),
+        atlas.GetLayerHeight()};
     for (unsigned i = 0; i < textures.GetTextures().size(); i++)
     {
         const auto& tex = textures.GetTexture(i);
-        mObjects.AddObject(
-            Quad{
-                static_cast<double>(tex.GetWidth()),
-                static_cast<double>(tex.GetHeight()),
-                static_cast<double>(textures.GetMaxDim()),
-                i});
+        const auto& region = atlas.GetRegion(i);
+        const auto minUV = glm::vec2{region.mX, region.mY} / layerDims;
+        const auto maxUV = glm::vec2{
+            region.mX + region.mWidth,
+            region.mY + region.mHeight} / layerDims;
+        mObjects.AddObject(Quad{minUV, maxUV, region.mLayer});
         mSpriteDimensions.emplace_back(
             tex.GetWidth(),
             tex.GetHeight());
@@ -107,23 +111,45 @@ glm::vec2 Sprites::GetDimensions(unsigned i) const
 SpriteManager::SpriteManager()
 :
     mSprites(),
+    mFreeSpriteSheets{},
     mNextSpriteSheet{0},
     mActiveSpriteSheet{}
 {
-    // Seems excessive...
-    mSprites.reserve(128);
 }
 
 SpriteSheetIndex SpriteManager::AddSpriteSheet()
 {
     const auto& logger = Logging::LogState::GetLogger("SpriteManager");
+    if (!mFreeSpriteSheets.empty())
+    {
+        const auto spriteSheetIndex = mFreeSpriteSheets.back();
+        mFreeSpriteSheets.pop_back();
+        logger.Debug() << "Reusing sprite sheet index: " << spriteSheetIndex << "\n";
+        ASSERT(!mSprites[spriteSheetIndex.mValue]);
+        mSprites[spriteSheetIndex.mValue] = std::make_unique<Sprites>();
+        return spriteSheetIndex;
+    }
+
     const auto spriteSheetIndex = NextSpriteSheet();
     logger.Debug() << "Adding sprite sheet index: " << spriteSheetIndex << "\n";
     ASSERT(mSprites.size() == spriteSheetIndex.mValue);
-    mSprites.emplace_back();
+    mSprites.emplace_back(std::make_unique<Sprites>());
     return spriteSheetIndex;
 }
 
+void SpriteManager::RemoveSpriteSheet(SpriteSheetIndex spriteSheet)
+{
+    const auto& logger = Logging::LogState::GetLogger("SpriteManager");
+    logger.Debug() << "Removing sprite sheet index: " << spriteSheet << "\n";
+    ASSERT(mSprites.size() > spriteSheet.mValue && mSprites[spriteSheet.mValue]);
+
+    if (mActiveSpriteSheet == spriteSheet)
+        DeactivateSpriteSheet();
+
+    mSprites[spriteSheet.mValue].reset();
+    mFreeSpriteSheets.emplace_back(spriteSheet);
+}
+
 void SpriteManager::DeactivateSpriteSheet()
 {
     if (mActiveSpriteSheet)
@@ -144,8 +170,8 @@ void SpriteManager::ActivateSpriteSheet(SpriteSheetIndex spriteSheet)
 
 Sprites& SpriteManager::GetSpriteSheet(SpriteSheetIndex spriteSheet)
 {
-    ASSERT(mSprites.size() > spriteSheet.mValue);
-    return mSprites[spriteSheet.mValue];
+    ASSERT(mSprites.size() > spriteSheet.mValue && mSprites[spriteSheet.mValue]);
+    return *mSprites[spriteSheet.mValue];
 }
 
 SpriteSheetIndex SpriteManager::NextSpriteSheet()
@@ -66,6 +66,8 @@ public:
     SpriteManager& operator=(SpriteManager&& other) = delete;
 
     SpriteSheetIndex AddSpriteSheet();
+    // Frees the sheet's GL resources, its index may be handed out again
+    void RemoveSpriteSheet(SpriteSheetIndex spriteSheet);
 
     void DeactivateSpriteSheet();
     void ActivateSpriteSheet(SpriteSheetIndex spriteSheet);
@@ -75,7 +77,9 @@ public:
 private:
     SpriteSheetIndex NextSpriteSheet();
 
-    std::vector<Sprites> mSprites;
+    // Sheets are never moved, Sprites' GL handles don't survive it
+    std::vector<std::unique_ptr<Sprites>> mSprites;
+    std::vector<SpriteSheetIndex> mFreeSpriteSheets;
 
     unsigned mNextSpriteSheet;
     std::optional<SpriteSheetIndex> mActiveSpriteSheet;
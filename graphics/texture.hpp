@@ -4,6 +4,8 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -50,6 +52,19 @@ public:
 
     const TextureType& GetTexture() const { return mTexture; }
 
+    // 8 bits per channel is all the palettes ever had, no need to
+    // upload floats
+    std::vector<std::uint8_t> GetRGBA8() const
+    {
+        auto data = std::vector<std::uint8_t>{};
+        data.reserve(mTexture.size() * 4);
+        for (const auto& pixel : mTexture)
+            for (unsigned i = 0; i < 4; i++)
+                data.emplace_back(static_cast<std::uint8_t>(
+                    std::clamp(pixel[i], 0.0f, 1.0f) * 255.0f + 0.5f));
+        return data;
+    }
+
 private:
     TextureType mTexture;
     unsigned mWidth;
@@ -0,0 +1,89 @@
+#include "graphics/textureAtlas.hpp"
+
+#include "com/assert.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+namespace Graphics {
+
+TextureAtlas::TextureAtlas(const std::vector<Texture>& textures)
+:
+    mRegions(textures.size()),
+    mLayerCount{0},
+    mLayerWidth{0},
+    mLayerHeight{0}
+{
+    if (textures.empty())
+        return;
+
+    unsigned maxWidth = 0;
+    unsigned maxHeight = 0;
+    for (const auto& texture : textures)
+    {
+        maxWidth = std::max(maxWidth, texture.GetWidth());
+        maxHeight = std::max(maxHeight, texture.GetHeight());
+    }
+
+    const auto packWidth = std::max(maxWidth, sMinLayerDim);
+    const auto packHeight = std::max(maxHeight, sMinLayerDim);
+
+    // Tallest size class first, widest first within a class
+    auto order = std::vector<std::size_t>(textures.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [&](auto lhs, auto rhs){
+            const auto& l = textures[lhs];
+            const auto& r = textures[rhs];
+            const auto lClass = std::bit_ceil(l.GetHeight());
+            const auto rClass = std::bit_ceil(r.GetHeight());
+            if (lClass != rClass)
+                return lClass > rClass;
+            return l.GetWidth() > r.GetWidth();
+        });
+
+    // Shelf packer, a new shelf starts when the current row is full and
+    // a new layer when the shelves reach the bottom
+    unsigned layer = 0;
+    unsigned x = 0;
+    unsigned y = 0;
+    unsigned shelfHeight = 0;
+    for (const auto i : order)
+    {
+        const auto width = textures[i].GetWidth();
+        const auto height = textures[i].GetHeight();
+
+        if (x + width > packWidth)
+        {
+            x = 0;
+            y += shelfHeight;
+            shelfHeight = 0;
+        }
+
+        if (y + height > packHeight)
+        {
+            layer++;
+            x = 0;
+            y = 0;
+            shelfHeight = 0;
+        }
+
+        mRegions[i] = AtlasRegion{layer, x, y, width, height};
+        mLayerWidth = std::max(mLayerWidth, x + width);
+        mLayerHeight = std::max(mLayerHeight, y + height);
+
+        x += width + sPadding;
+        shelfHeight = std::max(shelfHeight, height + sPadding);
+    }
+
+    mLayerCount = layer + 1;
+}
+
+const AtlasRegion& TextureAtlas::GetRegion(std::size_t i) const
+{
+    ASSERT(i < mRegions.size());
+    return mRegions[i];
+}
+
+}
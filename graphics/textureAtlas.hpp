@@ -0,0 +1,44 @@
+#pragma once
+
+#include "graphics/texture.hpp"
+
+#include <vector>
+
+namespace Graphics {
+
+struct AtlasRegion
+{
+    unsigned mLayer;
+    unsigned mX;
+    unsigned mY;
+    unsigned mWidth;
+    unsigned mHeight;
+};
+
+// Packs textures into as few texture array layers as possible. Textures
+// are bucketed by height so that similarly sized sprites share shelves,
+// then each layer is trimmed to the extent that was actually used.
+class TextureAtlas
+{
+public:
+    // Layers are at least this big in each dimension while packing
+    static constexpr unsigned sMinLayerDim = 256;
+    // Empty texels between packed textures so nearest sampling at
+    // a region edge never picks up a neighbour
+    static constexpr unsigned sPadding = 1;
+
+    explicit TextureAtlas(const std::vector<Texture>& textures);
+
+    const AtlasRegion& GetRegion(std::size_t i) const;
+    unsigned GetLayerCount() const { return mLayerCount; }
+    unsigned GetLayerWidth() const { return mLayerWidth; }
+    unsigned GetLayerHeight() const { return mLayerHeight; }
+
+private:
+    std::vector<AtlasRegion> mRegions;
+    unsigned mLayerCount;
+    unsigned mLayerWidth;
+    unsigned mLayerHeight;
+};
+
+}
@@ -24,11 +24,50 @@ public:
     Actors(
         Graphics::SpriteManager& spriteManager)
     :
+        mSpriteManager{spriteManager},
         mSpriteSheet{spriteManager.AddSpriteSheet()},
+        mLoaded{false},
         mActorDimensions{},
         mActorADimensions{},
         mLogger{Logging::LogState::GetLogger("Gui::Actors")}
     {
+    }
+
+    Graphics::SpriteSheetIndex GetSpriteSheet() const
+    {
+        return mSpriteSheet;
+    }
+
+    std::pair<
+        Graphics::TextureIndex,
+        glm::vec2>
+    GetActor(unsigned actor) const
+    {
+        Load();
+        unsigned index = actor - 1;
+        ASSERT(index < mActorDimensions.size());
+        return mActorDimensions[index];
+    }
+
+    std::pair<
+        Graphics::TextureIndex,
+        glm::vec2>
+    GetActorA(unsigned actor) const
+    {
+        Load();
+        ASSERT(mActorADimensions.contains(actor));
+        return mActorADimensions.find(actor)->second;
+    }
+
+private:
+    // The portraits are only needed once a dialog or character
+    // screen is shown, so don't load them at startup
+    void Load() const
+    {
+        if (mLoaded)
+            return;
+        mLoaded = true;
+
         auto textures = Graphics::TextureStore{};
 
         unsigned textureIndex = 0;
@@ -74,38 +113,15 @@ public:
             }
         }
 
-        auto& spriteSheet = spriteManager.GetSpriteSheet(mSpriteSheet);
+        auto& spriteSheet = mSpriteManager.GetSpriteSheet(mSpriteSheet);
         spriteSheet.LoadTexturesGL(textures);
     }
 
-    Graphics::SpriteSheetIndex GetSpriteSheet() const
-    {
-        return mSpriteSheet;
-    }
-
-    std::pair<
-        Graphics::TextureIndex,
-        glm::vec2>
-    GetActor(unsigned actor) const
-    {
-        unsigned index = actor - 1;
-        ASSERT(index < mActorDimensions.size());
-        return mActorDimensions[index];
-    }
-
-    std::pair<
-        Graphics::TextureIndex,
-        glm::vec2>
-    GetActorA(unsigned actor) const
-    {
-        ASSERT(mActorADimensions.contains(actor));
-        return mActorADimensions.find(actor)->second;
-    }
-
-private:
+    Graphics::SpriteManager& mSpriteManager;
     Graphics::SpriteSheetIndex mSpriteSheet;
-    std::vector<std::pair<Graphics::TextureIndex, glm::vec2>> mActorDimensions;
-    std::unordered_map<
+    mutable bool mLoaded;
+    mutable std::vector<std::pair<Graphics::TextureIndex, glm::vec2>> mActorDimensions;
+    mutable std::unordered_map<
         unsigned,
         std::pair<Graphics::TextureIndex, glm::vec2>> mActorADimensions;
 
@@ -8,6 +8,7 @@
 #include <glm/glm.hpp>
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <utility>
 #include <variant>
@@ -74,4 +75,30 @@ private:
     std::function<void()> mFinished;
 };
 
+// Calls poll every tick until it returns false
+class PollAnimator : public IAnimator
+{
+public:
+    PollAnimator(
+        std::function<bool()>&& poll)
+    :
+        mAlive{true},
+        mPoll{std::move(poll)}
+    {
+        ASSERT(mPoll);
+    }
+
+    void OnTimeDelta(double delta) override
+    {
+        if (mAlive)
+            mAlive = mPoll();
+    }
+
+    bool IsAlive() const override { return mAlive; }
+
+private:
+    bool mAlive;
+    std::function<bool()> mPoll;
+};
+
 }
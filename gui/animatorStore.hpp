@@ -30,8 +30,10 @@ public:
     void OnTimeDelta(double delta)
     {
         mLogger.Spam() << "Ticking : " << delta << "\n";
-        for (auto& animator : mAnimators)
-            animator->OnTimeDelta(delta);
+        // Animators may add animators while ticking, index rather than
+        // iterate so that growing the vector is safe
+        for (std::size_t i = 0; i < mAnimators.size(); i++)
+            mAnimators[i]->OnTimeDelta(delta);
 
         mAnimators.erase(
             std::remove_if(
@@ -42,6 +44,11 @@ public:
             mAnimators.end());
     }
 
+    bool HasAnimators() const
+    {
+        return !mAnimators.empty();
+    }
+
 private:
     std::vector<std::unique_ptr<IAnimator>> mAnimators;
     const Logging::Logger& mLogger;
@@ -60,6 +60,8 @@ public:
 
             Logging::LogDebug("Gui::Draggable") << "DragStart: " << this << "\n";
             mDragStart = click;
+            // The cursor can outrun the widget while dragging
+            Base::SubscribeMouseMoves(true);
         }
 
         return false;
@@ -86,6 +88,7 @@ public:
     bool LeftMouseReleased(glm::vec2 click)
     {
         mDragStart.reset();
+        Base::SubscribeMouseMoves(false);
 
         if (mDragging)
         {
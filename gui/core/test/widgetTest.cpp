@@ -105,6 +105,50 @@ TEST_F(WidgetTestFixture, RelativeMouseEventPropagation)
              - mChild1.GetPositionInfo().mPosition));
 }
 
+TEST_F(WidgetTestFixture, MouseMoveOnlyReachesHoveredWidgets)
+{
+    auto sibling = TestWidget{
+        RectTag{},
+        glm::vec2{30, 30},
+        glm::vec2{10, 10},
+        glm::vec4{},
+        true};
+    mRoot.AddChildBack(&sibling);
+
+    // Over child1 only
+    (void) mRoot.OnMouseEvent(MouseMove{glm::vec2{13, 13}});
+    EXPECT_EQ(mChild1.mMouseEvents.size(), 1);
+    EXPECT_EQ(sibling.mMouseEvents.size(), 0);
+
+    // Over the sibling, child1 still sees the cursor leave
+    (void) mRoot.OnMouseEvent(MouseMove{glm::vec2{45, 45}});
+    EXPECT_EQ(mChild1.mMouseEvents.size(), 2);
+    EXPECT_EQ(sibling.mMouseEvents.size(), 1);
+
+    (void) mRoot.OnMouseEvent(MouseMove{glm::vec2{46, 46}});
+    EXPECT_EQ(mChild1.mMouseEvents.size(), 2);
+    EXPECT_EQ(sibling.mMouseEvents.size(), 2);
+
+    // Subscribed widgets get every move
+    mChild2.SubscribeMouseMoves(true);
+    (void) mRoot.OnMouseEvent(MouseMove{glm::vec2{46, 46}});
+    EXPECT_EQ(mChild2.mMouseEvents.size(), 1);
+    EXPECT_EQ(mChild1.mMouseEvents.size(), 3);
+
+    // Moving a widget under the cursor updates its bounds
+    mChild2.SubscribeMouseMoves(false);
+    sibling.SetPosition(glm::vec2{0, 0});
+    (void) mRoot.OnMouseEvent(MouseMove{glm::vec2{46, 46}});
+    EXPECT_EQ(sibling.mMouseEvents.size(), 4);
+    (void) mRoot.OnMouseEvent(MouseMove{glm::vec2{46, 46}});
+    EXPECT_EQ(sibling.mMouseEvents.size(), 4);
+
+    // Clicks still reach everything
+    (void) mRoot.OnMouseEvent(LeftMousePress{glm::vec2{46, 46}});
+    EXPECT_EQ(sibling.mMouseEvents.size(), 5);
+    EXPECT_EQ(mChild2.mMouseEvents.size(), 2);
+}
+
 TEST_F(WidgetTestFixture, DragEventPropagationUp)
 {
     const auto event    = DragEvent{DragStarted{&mChild2, glm::vec2{8, 8}}};
@@ -28,7 +28,13 @@ Widget::Widget(
         childrenRelative},
     mParent{nullptr},
     mChildren{},
-    mActive{true}
+    mActive{true},
+    mBoundsMin{},
+    mBoundsMax{},
+    mBoundsDirty{true},
+    mMouseMoveSubscribed{false},
+    mSubtreeSubscribed{false},
+    mHovered{false}
 {}
 
 Widget::Widget(
@@ -123,10 +129,14 @@ bool Widget::OnMouseEvent(const MouseEvent& event)
 {
     if (mActive)
     {
+        const auto childEvent = TransformEvent(event);
+        const auto* move = std::get_if<MouseMove>(&childEvent);
         for (auto& c : mChildren)
         {
-            const bool handled = c->OnMouseEvent(
-                TransformEvent(event));
+            if (move && !c->WantsMouseMove(move->mValue))
+                continue;
+
+            const bool handled = c->OnMouseEvent(childEvent);
             if (handled)
                 return true;
         }
@@ -177,6 +187,7 @@ void Widget::AddChildFront(Widget* widget)
         == mChildren.end());
     mChildren.insert(mChildren.begin(), widget);
     widget->SetParent(this);
+    InvalidateBounds();
 
     Graphics::IGuiElement::AddChildFront(
         static_cast<Graphics::IGuiElement*>(widget));
@@ -188,6 +199,7 @@ void Widget::AddChildBack(Widget* widget)
         == mChildren.end());
     mChildren.emplace_back(widget);
     widget->SetParent(this);
+    InvalidateBounds();
 
     Graphics::IGuiElement::AddChildBack(
         static_cast<Graphics::IGuiElement*>(widget));
@@ -207,6 +219,7 @@ void Widget::RemoveChild(Widget* elem)
     const auto it = std::find(mChildren.begin(), mChildren.end(), elem);
     ASSERT(it != mChildren.end());
     mChildren.erase(it);
+    InvalidateBounds();
 }
 
 void Widget::PopChild()
@@ -226,6 +239,7 @@ void Widget::ClearChildren()
         child->SetParent(nullptr);
 
     mChildren.clear();
+    InvalidateBounds();
 }
 
 void Widget::SetParent(Widget* widget)
@@ -237,6 +251,7 @@ void Widget::SetCenter(glm::vec2 pos)
 {
     mPositionInfo.mPosition = pos
         - (mPositionInfo.mDimensions / 2.0f);
+    InvalidateBounds();
 }
 
 glm::vec2 Widget::GetCenter() const
@@ -258,11 +273,13 @@ glm::vec2 Widget::GetDimensions() const
 void Widget::SetPosition(glm::vec2 pos)
 {
     mPositionInfo.mPosition = pos;
+    InvalidateBounds();
 }
 
 void Widget::AdjustPosition(glm::vec2 adj)
 {
     mPositionInfo.mPosition += adj;
+    InvalidateBounds();
 }
 
 void Widget::SetSpriteSheet(Graphics::SpriteSheetIndex spriteSheet)
@@ -288,6 +305,7 @@ void Widget::SetColor(glm::vec4 color)
 void Widget::SetDimensions(glm::vec2 dims)
 {
     mPositionInfo.mDimensions = dims;
+    InvalidateBounds();
 }
 
 std::size_t Widget::size() const
@@ -295,6 +313,56 @@ std::size_t Widget::size() const
     return mChildren.size();
 }
 
+void Widget::SubscribeMouseMoves(bool subscribe)
+{
+    if (mMouseMoveSubscribed == subscribe)
+        return;
+    mMouseMoveSubscribed = subscribe;
+    InvalidateBounds();
+}
+
+void Widget::InvalidateBounds()
+{
+    // Not stopping at the first dirty ancestor keeps this correct
+    // for widgets that have been added to more than one parent
+    for (auto* widget = this; widget != nullptr; widget = widget->mParent)
+        widget->mBoundsDirty = true;
+}
+
+void Widget::UpdateBounds()
+{
+    if (!mBoundsDirty)
+        return;
+
+    const auto& pos = mPositionInfo.mPosition;
+    const auto corner = pos + mPositionInfo.mDimensions;
+    mBoundsMin = glm::min(pos, corner);
+    mBoundsMax = glm::max(pos, corner);
+    mSubtreeSubscribed = mMouseMoveSubscribed;
+
+    const auto offset = mPositionInfo.mChildrenRelative
+        ? pos
+        : glm::vec2{0};
+    for (auto* c : mChildren)
+    {
+        c->UpdateBounds();
+        mBoundsMin = glm::min(mBoundsMin, c->mBoundsMin + offset);
+        mBoundsMax = glm::max(mBoundsMax, c->mBoundsMax + offset);
+        mSubtreeSubscribed = mSubtreeSubscribed || c->mSubtreeSubscribed;
+    }
+
+    mBoundsDirty = false;
+}
+
+bool Widget::WantsMouseMove(glm::vec2 pos)
+{
+    UpdateBounds();
+    const bool wasHovered = mHovered;
+    mHovered = glm::all(glm::greaterThanEqual(pos, mBoundsMin))
+        && glm::all(glm::lessThanEqual(pos, mBoundsMax));
+    return mHovered || wasHovered || mSubtreeSubscribed;
+}
+
 bool Widget::Within(glm::vec2 click)
 {
     return Graphics::PointWithinRectangle(
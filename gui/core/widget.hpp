@@ -92,6 +92,12 @@ public:
 
     std::size_t size() const;
 
+    // Mouse moves are only routed to children whose subtree is under
+    // the cursor, or was under it on the previous move so they see
+    // the cursor leave. Widgets that need every move regardless of
+    // where the cursor is (e.g. while dragging) subscribe here.
+    void SubscribeMouseMoves(bool subscribe);
+
 
 protected:
     bool Within(glm::vec2 click);
@@ -101,11 +107,28 @@ protected:
     DragEvent TransformEvent(const DragEvent&);
     DragEvent InverseTransformEvent(const DragEvent&);
 
+    // Must be called whenever the geometry of this widget or
+    // its children changes outside of the setters above
+    void InvalidateBounds();
+
     Graphics::DrawInfo mDrawInfo;
     Graphics::PositionInfo mPositionInfo;
     Widget* mParent;
     std::vector<Widget*> mChildren;
     bool mActive;
+
+private:
+    void UpdateBounds();
+    bool WantsMouseMove(glm::vec2 pos);
+
+    // Bounds of this widget and all its descendants in the
+    // parent's space
+    glm::vec2 mBoundsMin;
+    glm::vec2 mBoundsMax;
+    bool mBoundsDirty;
+    bool mMouseMoveSubscribed;
+    bool mSubtreeSubscribed;
+    bool mHovered;
 };
 
 template <typename T>
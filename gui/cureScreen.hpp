@@ -165,6 +165,7 @@ private:
             mGuiManager.StartDialog(BAK::DialogSources::mHealDialogPostHealing, false, false, this);
             auto& character = mGameState.GetParty().GetCharacter(mSelectedCharacter);
             BAK::Temple::CureCharacter(character.mSkills, character.mConditions, mTempleNumber == BAK::Temple::sTempleOfSung);
+            character.InvalidateSkills();
         }
     }
 
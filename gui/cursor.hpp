@@ -108,6 +108,7 @@ private:
         const auto & [dimensions, texture] = GetCursor();
         mDrawInfo.mTexture = Graphics::TextureIndex{texture};
         mPositionInfo.mDimensions = dimensions;
+        InvalidateBounds();
 
         std::stringstream ss{};
         std::stack<std::pair<Dimensions, CursorIndex>> cursors{};
@@ -50,6 +50,8 @@ DialogRunner::DialogRunner(
     mLogger{Logging::LogState::GetLogger("Gui::DialogRunner")}
 {
     AddChildBack(&mDialogDisplay);
+    // Tooltips follow the mouse wherever it is
+    SubscribeMouseMoves(true);
     ASSERT(mFinished);
 }
 
@@ -227,7 +229,7 @@ std::optional<BAK::Target> DialogRunner::GetNextTarget()
     if (snip.IsRandomChoice())
     {
         ASSERT(snip.GetChoices().size() > 0);
-        const auto choice = GetRandomNumber(0, snip.GetChoices().size() - 1);
+        const auto choice = GetRandomNumber(0, snip.GetChoices().size() - 1, RandomStream::Dialog);
         return snip.GetChoices()[choice].mTarget;
     }
     else if (snip.GetChoices().size() >= 1)
@@ -299,26 +301,35 @@ void DialogRunner::ShowDialogChoices()
     mChoices.SetPosition(glm::vec2{15, 125});
     mChoices.SetDimensions(glm::vec2{295, 66});
 
-    auto choices = std::vector<std::pair<BAK::ChoiceIndex, std::string>>{};
-    unsigned i = 0;
+    auto conversationChoices = std::vector<BAK::ConversationChoice>{};
+    auto eventPtrs = std::vector<unsigned>{};
     for (const auto& c : GetSnippet().GetChoices())
     {
         if (std::holds_alternative<BAK::ConversationChoice>(c.mChoice))
         {
-            const auto choice = std::get<BAK::ConversationChoice>(c.mChoice);
-            if (mGameState.GetEventStateBool(choice.mEventPointer)
-                && !mGameState.CheckInhibited(choice))
-            {
-                const auto fontStyle = mGameState.CheckDiscussed(choice)
-                    ? '\xf4' // unbold
-                    : '#';
-                choices.emplace_back(
-                    std::make_pair(
-                        BAK::ChoiceIndex{choice.mEventPointer},
-                        fontStyle + std::string{
-                            mKeywords.GetDialogChoice(choice.mEventPointer)}));
-
-            }
+            conversationChoices.emplace_back(std::get<BAK::ConversationChoice>(c.mChoice));
+            eventPtrs.emplace_back(conversationChoices.back().mEventPointer);
+        }
+    }
+
+    auto eventStates = std::vector<unsigned>(eventPtrs.size());
+    mGameState.GetEventStates(eventPtrs, eventStates);
+
+    auto choices = std::vector<std::pair<BAK::ChoiceIndex, std::string>>{};
+    for (unsigned i = 0; i < conversationChoices.size(); i++)
+    {
+        const auto& choice = conversationChoices[i];
+        if ((eventStates[i] & 0x1) == 1
+            && !mGameState.CheckInhibited(choice))
+        {
+            const auto fontStyle = mGameState.CheckDiscussed(choice)
+                ? '\xf4' // unbold
+                : '#';
+            choices.emplace_back(
+                std::make_pair(
+                    BAK::ChoiceIndex{choice.mEventPointer},
+                    fontStyle + std::string{
+                        mKeywords.GetDialogChoice(choice.mEventPointer)}));
         }
     }
     choices.emplace_back(std::make_pair(-1, "Goodbye"));
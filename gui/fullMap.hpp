@@ -2,6 +2,8 @@
 
 #include "bak/coordinates.hpp"
 #include "bak/fmap.hpp"
+#include "bak/gameState.hpp"
+#include "bak/IGameStateListener.hpp"
 #include "bak/layout.hpp"
 #include "bak/textureFactory.hpp"
 
@@ -22,7 +24,7 @@
 
 namespace Gui {
 
-class FullMap : public Widget
+class FullMap : public Widget, public BAK::IGameStateListener
 {
 public:
     static constexpr auto sLayoutFile = "REQ_FMAP.DAT";
@@ -69,6 +71,7 @@ public:
             false
         },  
         mTowns{},
+        mLocationDirty{true},
         mLogger{Logging::LogState::GetLogger("Gui::FullMap")}
     {
         mTowns.reserve(mFMapTowns.GetTowns().size());
@@ -82,6 +85,15 @@ public:
         }
 
         AddChildren();
+        mGameState.AddListener(this);
+    }
+
+    FullMap(const FullMap&) = delete;
+    FullMap& operator=(const FullMap&) = delete;
+
+    ~FullMap()
+    {
+        mGameState.RemoveListener(this);
     }
 
     void AddChildren()
@@ -98,9 +110,26 @@ public:
         return 4 * ((bakAngle / unit) % 8);
     }
 
+    void OnGameStateChanged(BAK::GameStateChange::Mask changes) override
+    {
+        using namespace BAK::GameStateChange;
+        if ((changes & (Position | Heading | Zone)) == 0)
+            return;
+
+        mLocationDirty = true;
+        // Only track the player while the map is displayed,
+        // otherwise wait until it is shown
+        if (mParent != nullptr)
+            UpdateLocation();
+    }
+
     void UpdateLocation()
     {
+        if (!mLocationDirty)
+            return;
+
         SetPlayerLocation(mGameState.GetZone(), mGameState.GetLocation());
+        mLocationDirty = false;
     }
 
     void SetPlayerLocation(
@@ -134,6 +163,7 @@ private:
 
     Widget mPlayerLocation;
     std::vector<TownLabel> mTowns;
+    bool mLocationDirty;
 
     const Logging::Logger& mLogger;
 };
@@ -10,12 +10,14 @@
 
 #include "com/assert.hpp"
 
+#include <utility>
+
 namespace Gui {
 
 GDSScene::GDSScene(
     Cursor& cursor,
     BAK::HotspotRef hotspotRef,
-    Graphics::SpriteManager& spriteManager,
+    SceneTextureCache& sceneTextures,
     const Actors& actors,
     const Backgrounds& backgrounds,
     const Font& font,
@@ -24,7 +26,8 @@ GDSScene::GDSScene(
 :
     Widget{
         Graphics::DrawMode::Sprite,
-        spriteManager.AddSpriteSheet(),
+        // Replaced by the dialog screen's sheet below
+        Graphics::SpriteSheetIndex{0},
         Graphics::TextureIndex{0},
         Graphics::ColorMode::Texture,
         glm::vec4{1},
@@ -40,8 +43,9 @@ GDSScene::GDSScene(
             mReference.ToFilename())},
     mSong{mSceneHotspots.mSong},
     mFlavourText{BAK::KeyTarget{0x00000}},
-    mSpriteSheet{GetDrawInfo().mSpriteSheet},
-    mSpriteManager{spriteManager},
+    mSceneTextures{sceneTextures},
+    mDialogTextures{mSceneTextures.GetTextures({SceneImage{"DIALOG.SCX", "OPTIONS.PAL"}})},
+    mSpriteSheet{mDialogTextures->GetSpriteSheet()},
     // bitofa hack - all gds scenes have such a frame
     mFrame{
         Graphics::DrawMode::Rect,
@@ -78,15 +82,8 @@ GDSScene::GDSScene(
     mLogger{Logging::LogState::GetLogger("Gui::GDSScene")}
 {
     mLogger.Debug() << "Song: " << mSong << "\n";
-    auto textures = Graphics::TextureStore{};
-    BAK::TextureFactory::AddScreenToTextureStore(
-        textures, "DIALOG.SCX", "OPTIONS.PAL");
-
-    const auto [x, y] = textures.GetTexture(0).GetDims();
-    mSpriteManager
-        .GetSpriteSheet(mSpriteSheet)
-        .LoadTexturesGL(textures);
-
+    SetSpriteSheet(mSpriteSheet);
+    const auto [x, y] = mDialogTextures->GetTextures().GetTexture(0).GetDims();
     SetDimensions(glm::vec2{x, y});
 
     auto fb = BAK::FileBufferFactory::Get().CreateDataBuffer(mReference.ToFilename());
@@ -96,7 +93,7 @@ GDSScene::GDSScene(
     auto* container = mGameState.GetContainerForGDSScene(mReference);
     if (container && container->IsShop())
     {
-        auto& shopStats = container->GetShop();
+        const auto& shopStats = std::as_const(*container).GetShop();
         mGameState.SetShopType(shopStats.mRepairTypes);
     }
 
@@ -108,7 +105,7 @@ GDSScene::GDSScene(
     // Unlikely we ever nest this deep
     mStaticTTMs.reserve(mMaxSceneNesting);
     mStaticTTMs.emplace_back(
-        mSpriteManager,
+        mSceneTextures,
         scene1,
         scene2);
 
@@ -203,7 +200,7 @@ void GDSScene::HandleHotspotLeftClicked(const BAK::Hotspot& hotspot)
             // respect the earlier reserve
             ASSERT(mStaticTTMs.size () < mMaxSceneNesting);
             mStaticTTMs.emplace_back(
-                mSpriteManager,
+                mSceneTextures,
                 scene1,
                 scene2);
             DisplayNPCBackground();
@@ -224,7 +221,7 @@ void GDSScene::HandleHotspotLeftClicked(const BAK::Hotspot& hotspot)
         mTemple.EnterTemple(
             BAK::KeyTarget{hotspot.mActionArg3},
             mSceneHotspots.mTempleIndex, 
-            container->GetShop());
+            std::as_const(*container).GetShop());
     }
     else if (hotspot.mAction == BAK::HotspotAction::TELEPORT)
     {
@@ -262,7 +259,7 @@ void GDSScene::HandleHotspotLeftClicked(const BAK::Hotspot& hotspot)
             StartDialog(BAK::KeyTarget{hotspot.mActionArg3}, false);
 
             auto* container = mGameState.GetContainerForGDSScene(mReference);
-            mLogger.Debug() << container->GetShop() << "\n";
+            mLogger.Debug() << std::as_const(*container).GetShop() << "\n";
             mState = State::Repair;
         }
         else
@@ -348,7 +345,7 @@ void GDSScene::DialogFinished(const std::optional<BAK::ChoiceIndex>& choice)
         if (!choice || (choice && choice->mValue == BAK::Keywords::sYesIndex))
         {
             auto* container = mGameState.GetContainerForGDSScene(mReference);
-            mRepair.EnterRepair(container->GetShop());
+            mRepair.EnterRepair(std::as_const(*container).GetShop());
         }
     }
     else if (mState == State::Teleport)
@@ -24,7 +24,7 @@ public:
     GDSScene(
         Cursor& cursor,
         BAK::HotspotRef hotspotRef,
-        Graphics::SpriteManager& spriteManager,
+        SceneTextureCache& sceneTextures,
         const Actors& actors,
         const Backgrounds& backgrounds,
         const Font& font,
@@ -68,8 +68,9 @@ public:
     unsigned mSong;
     BAK::Target mFlavourText;
 
+    SceneTextureCache& mSceneTextures;
+    std::shared_ptr<const SceneTextures> mDialogTextures;
     Graphics::SpriteSheetIndex mSpriteSheet;
-    Graphics::SpriteManager& mSpriteManager;
 
     // Frame to surround the scene
     Widget mFrame;
@@ -12,6 +12,7 @@
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
 
+#include "gui/animator.hpp"
 #include "gui/animatorStore.hpp"
 #include "gui/campScreen.hpp"
 #include "gui/cureScreen.hpp"
@@ -24,6 +25,7 @@
 #include "gui/icons.hpp"
 #include "gui/info/infoScreen.hpp"
 #include "gui/inventory/inventoryScreen.hpp"
+#include "gui/lazyScreen.hpp"
 #include "gui/lock/lockScreen.hpp"
 #include "gui/lock/moredhelScreen.hpp"
 #include "gui/mainMenuScreen.hpp"
@@ -34,6 +36,7 @@
 #include <glm/glm.hpp>
 
 #include <iostream>
+#include <utility>
 #include <variant>
 
 namespace Gui {
@@ -87,77 +90,87 @@ public:
         },
         mWorldDialogFrame{mBackgrounds},
         mSpriteManager{spriteManager},
-        mMainView{*this, mBackgrounds, mIcons},
+        mMainView{*this, gameState, mBackgrounds, mIcons},
         mMainMenu{*this, mBackgrounds, mIcons, mFontManager.GetGameFont()},
-        mInfoScreen{
-            *this,
-            mActors,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
-        mInventoryScreen{
-            *this,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
-        mCampScreen{
-            *this,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
-        mCureScreen{
-            *this,
-            mActors,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
-        mLockScreen{
-            *this,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
-        mFullMap{
-            *this,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
-        mMoredhelScreen{
-            *this,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetAlienFont(),
-            mFontManager.GetPuzzleFont(),
-            mGameState
-        },
-        mTeleportScreen{
-            *this,
-            mBackgrounds,
-            mIcons,
-            mFontManager.GetGameFont(),
-            mGameState
-        },
+        mInfoScreen{[this]{
+            return std::make_unique<InfoScreen>(
+                *this,
+                mActors,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
+        mInventoryScreen{[this]{
+            return std::make_unique<InventoryScreen>(
+                *this,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
+        mCampScreen{[this]{
+            return std::make_unique<CampScreen>(
+                *this,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
+        mCureScreen{[this]{
+            return std::make_unique<CureScreen>(
+                *this,
+                mActors,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
+        mLockScreen{[this]{
+            return std::make_unique<LockScreen>(
+                *this,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
+        mFullMap{[this]{
+            return std::make_unique<FullMap>(
+                *this,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
+        mMoredhelScreen{[this]{
+            return std::make_unique<MoredhelScreen>(
+                *this,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetAlienFont(),
+                mFontManager.GetPuzzleFont(),
+                mGameState);
+        }},
+        mTeleportScreen{[this]{
+            return std::make_unique<TeleportScreen>(
+                *this,
+                mBackgrounds,
+                mIcons,
+                mFontManager.GetGameFont(),
+                mGameState);
+        }},
         mFadeScreen{
             *this,
             [this]{ FadeInDone(); },
             [this]{ FadeOutDone(); }
         },
         mFadeFunction{},
+        mSceneTextures{spriteManager},
         mGdsScenes{},
         mDialogScene{nullptr},
         mGuiScreens{},
         mAnimatorStore{},
+        mPreloadStarted{false},
         mZoneLoader{nullptr},
         mLogger{Logging::LogState::GetLogger("Gui::GuiManager")}
     {
@@ -192,7 +205,16 @@ public:
 
     void SaveGame(const BAK::SaveFile& saveFile) override
     {
-        mGameState.Save(saveFile);
+        const auto saving = mGameState.Save(
+            saveFile,
+            [this, name=saveFile.mName](bool success){
+                if (success)
+                    mLogger.Info() << "Game saved: " << name << "\n";
+                else
+                    mLogger.Error() << "Game NOT saved, failed to write: " << name << "\n";
+            });
+        if (!saving)
+            mLogger.Error() << "Game NOT saved, no game data: " << saveFile.mName << "\n";
         EnterMainView();
     }
 
@@ -218,13 +240,40 @@ public:
         return mScreenStack.Top() == &mMainView;
     }
 
+    // False while a full screen GUI hides the 3D world
+    bool IsWorldVisible() const
+    {
+        return !mScreenStack.IsCovered();
+    }
+
     void EnterMainView() override
     {
-        mMainView.UpdatePartyMembers(mGameState);
+        mMainView.UpdatePartyMembers();
         DoFade(1.0,[this]{
             mScreenStack.PopScreen();
             mScreenStack.PushScreen(&mMainView);
         });
+        PreloadScreens();
+    }
+
+    // Build the screens most likely to be opened from the main view
+    // one per frame, so that opening them later doesn't stall
+    void PreloadScreens()
+    {
+        if (mPreloadStarted)
+            return;
+        mPreloadStarted = true;
+
+        auto preloads = std::vector<std::function<void()>>{
+            [this]{ mInventoryScreen.Get(); },
+            [this]{ mInfoScreen.Get(); },
+            [this]{ mFullMap.Get(); },
+            [this]{ mCampScreen.Get(); }};
+        AddAnimator(std::make_unique<PollAnimator>(
+            [preloads=std::move(preloads), next=0u]() mutable {
+                preloads[next++]();
+                return next < preloads.size();
+            }));
     }
 
     void EnterMainMenu(bool gameRunning) override
@@ -234,7 +283,7 @@ public:
             {
                 mScreenStack.PopScreen();
             }
-            mScreenStack.PushScreen(&mMainMenu);
+            mScreenStack.PushScreen(&mMainMenu, ScreenCoverage::Full);
             mMainMenu.EnterMainMenu(gameRunning);
         });
     }
@@ -258,6 +307,13 @@ public:
     void OnTimeDelta(double delta)
     {
         mAnimatorStore.OnTimeDelta(delta);
+        BAK::SaveWriter::Get().PollCompleted();
+    }
+
+    // True while anything on screen is animating
+    bool IsAnimating() const
+    {
+        return mAnimatorStore.HasAnimators();
     }
 
     void AddAnimator(std::unique_ptr<IAnimator>&& animator) override
@@ -276,7 +332,7 @@ public:
             std::make_unique<GDSScene>(
                 mCursor,
                 hotspot,
-                mSpriteManager,
+                mSceneTextures,
                 mActors,
                 mBackgrounds,
                 mFontManager.GetGameFont(),
@@ -298,7 +354,7 @@ public:
             mGuiScreens.push(finished);
         }
 
-        mScreenStack.PushScreen(mGdsScenes.back().get());
+        mScreenStack.PushScreen(mGdsScenes.back().get(), ScreenCoverage::Full);
         mGdsScenes.back()->EnterGDSScene();
     }
 
@@ -375,9 +431,9 @@ public:
     void ShowCharacterPortrait(BAK::ActiveCharIndex character) override
     {
         DoFade(.8, [this, character]{
-            mInfoScreen.SetSelectedCharacter(character);
-            mInfoScreen.UpdateCharacter();
-            mScreenStack.PushScreen(&mInfoScreen);
+            mInfoScreen->SetSelectedCharacter(character);
+            mInfoScreen->UpdateCharacter();
+            mScreenStack.PushScreen(&mInfoScreen.Get(), ScreenCoverage::Full);
         });
     }
 
@@ -391,10 +447,10 @@ public:
         DoFade(.8, [this, character]{
             mCursor.PushCursor(0);
             mGuiScreens.push(GuiScreen{[](){}});
-            mInventoryScreen.SetSelectionMode(false, nullptr);
+            mInventoryScreen->SetSelectionMode(false, nullptr);
 
-            mInventoryScreen.SetSelectedCharacter(character);
-            mScreenStack.PushScreen(&mInventoryScreen);
+            mInventoryScreen->SetSelectedCharacter(character);
+            mScreenStack.PushScreen(&mInventoryScreen.Get(), ScreenCoverage::Full);
         });
     }
 
@@ -402,16 +458,16 @@ public:
     {
         mCursor.PushCursor(0);
         ASSERT(container);
-        ASSERT(container->GetInventory().GetCapacity() > 0);
+        ASSERT(std::as_const(*container).GetInventory().GetCapacity() > 0);
 
         mGuiScreens.push(GuiScreen{[&](){
-            mInventoryScreen.ClearContainer();
+            mInventoryScreen->ClearContainer();
         }});
 
-        mInventoryScreen.SetSelectionMode(false, nullptr);
-        mInventoryScreen.SetContainer(container);
+        mInventoryScreen->SetSelectionMode(false, nullptr);
+        mInventoryScreen->SetContainer(container);
         mLogger.Debug() << __FUNCTION__ << " Pushing inv\n";
-        mScreenStack.PushScreen(&mInventoryScreen);
+        mScreenStack.PushScreen(&mInventoryScreen.Get(), ScreenCoverage::Full);
     }
 
     void SelectItem(std::function<void(std::optional<std::pair<BAK::ActiveCharIndex, BAK::InventoryIndex>>)>&& itemSelected) override
@@ -423,9 +479,9 @@ public:
                 selected(std::nullopt);
         }});
 
-        mInventoryScreen.SetSelectionMode(true, std::move(itemSelected));
+        mInventoryScreen->SetSelectionMode(true, std::move(itemSelected));
         mLogger.Debug() << __FUNCTION__ << " Pushing select item\n";
-        mScreenStack.PushScreen(&mInventoryScreen);
+        mScreenStack.PushScreen(&mInventoryScreen.Get(), ScreenCoverage::Full);
     }
 
     void ExitInventory() override
@@ -444,15 +500,15 @@ public:
         std::function<void()>&& finished) override
     {
         ASSERT(container->HasLock()
-            && (container->GetLock().IsFairyChest()
-                || !container->GetLock().IsTrapped()));
+            && (std::as_const(*container).GetLock().IsFairyChest()
+                || !std::as_const(*container).GetLock().IsTrapped()));
 
         mCursor.PushCursor(0);
 
-        if (container->GetLock().IsFairyChest())
+        if (std::as_const(*container).GetLock().IsFairyChest())
         {
-            mMoredhelScreen.SetContainer(container);
-            mScreenStack.PushScreen(&mMoredhelScreen);
+            mMoredhelScreen->SetContainer(container);
+            mScreenStack.PushScreen(&mMoredhelScreen.Get(), ScreenCoverage::Full);
             AudioA::AudioManager::Get().ChangeMusicTrack(AudioA::PUZZLE_CHEST_THEME);
             mGuiScreens.push(GuiScreen{
                 [fin = std::move(finished)](){
@@ -462,8 +518,8 @@ public:
         }
         else
         {
-            mLockScreen.SetContainer(container);
-            mScreenStack.PushScreen(&mLockScreen);
+            mLockScreen->SetContainer(container);
+            mScreenStack.PushScreen(&mLockScreen.Get(), ScreenCoverage::Full);
             mGuiScreens.push(finished);
         }
     }
@@ -471,15 +527,16 @@ public:
     void ShowCamp(bool isInn) override
     {
         DoFade(.8, [this, isInn]{
-            mCampScreen.SetIsInn(isInn);
-            mScreenStack.PushScreen(&mCampScreen);
+            mCampScreen->SetIsInn(isInn);
+            mScreenStack.PushScreen(&mCampScreen.Get(), ScreenCoverage::Full);
         });
     }
 
     void ShowFullMap() override
     {
         DoFade(.8, [this]{
-            mScreenStack.PushScreen(&mFullMap);
+            mFullMap->UpdateLocation();
+            mScreenStack.PushScreen(&mFullMap.Get(), ScreenCoverage::Full);
         });
     }
 
@@ -489,17 +546,17 @@ public:
         std::function<void()>&& finished) override
     {
         DoFade(.8, [this, templeNumber, cureFactor, finished=std::move(finished)]() mutable {
-            mCureScreen.EnterScreen(templeNumber, cureFactor, std::move(finished));
-            mScreenStack.PushScreen(&mCureScreen);
+            mCureScreen->EnterScreen(templeNumber, cureFactor, std::move(finished));
+            mScreenStack.PushScreen(&mCureScreen.Get(), ScreenCoverage::Full);
         });
     }
 
     void ShowTeleport(unsigned sourceTemple) override
     {
-        mTeleportScreen.SetSourceTemple(sourceTemple);
+        mTeleportScreen->SetSourceTemple(sourceTemple);
         DoFade(.8, [this]{
             mCursor.PopCursor();
-            mScreenStack.PushScreen(&mTeleportScreen);
+            mScreenStack.PushScreen(&mTeleportScreen.Get(), ScreenCoverage::Full);
         });
     }
 
@@ -512,12 +569,14 @@ public:
 
     bool IsLockOpened() const override
     {
-        return mLockScreen.IsUnlocked();
+        const auto* lockScreen = mLockScreen.GetIfLoaded();
+        return lockScreen && lockScreen->IsUnlocked();
     } 
 
     bool IsWordLockOpened() const override
     {
-        return mMoredhelScreen.IsUnlocked();
+        const auto* moredhelScreen = mMoredhelScreen.GetIfLoaded();
+        return moredhelScreen && moredhelScreen->IsUnlocked();
     }
 
     void PopGuiScreen()
@@ -562,22 +621,24 @@ public:
 
     MainView mMainView;
     MainMenuScreen mMainMenu;
-    InfoScreen mInfoScreen;
-    InventoryScreen mInventoryScreen;
-    CampScreen mCampScreen;
-    CureScreen mCureScreen;
-    LockScreen mLockScreen;
-    FullMap mFullMap;
-    MoredhelScreen mMoredhelScreen;
-    TeleportScreen mTeleportScreen;
+    LazyScreen<InfoScreen> mInfoScreen;
+    LazyScreen<InventoryScreen> mInventoryScreen;
+    LazyScreen<CampScreen> mCampScreen;
+    LazyScreen<CureScreen> mCureScreen;
+    LazyScreen<LockScreen> mLockScreen;
+    LazyScreen<FullMap> mFullMap;
+    LazyScreen<MoredhelScreen> mMoredhelScreen;
+    LazyScreen<TeleportScreen> mTeleportScreen;
     FadeScreen mFadeScreen;
     std::function<void()> mFadeFunction;
+    SceneTextureCache mSceneTextures;
     std::vector<std::unique_ptr<GDSScene>> mGdsScenes;
 
     IDialogScene* mDialogScene;
     std::stack<GuiScreen> mGuiScreens;
 
     AnimatorStore mAnimatorStore;
+    bool mPreloadStarted;
     BAK::IZoneLoader* mZoneLoader;
 
     const Logging::Logger& mLogger;
@@ -9,6 +9,7 @@
 #include "gui/inventory/equipmentSlot.hpp"
 #include "gui/inventory/inventorySlot.hpp"
 #include "gui/inventory/itemArranger.hpp"
+#include "gui/inventory/slotPool.hpp"
 
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
@@ -34,6 +35,9 @@ class ContainerDisplay :
     public Widget
 {
 public:
+    static constexpr auto sColumns = 12;
+    static constexpr auto sRows = 4;
+
     ContainerDisplay(
         glm::vec2 pos,
         glm::vec2 dims,
@@ -51,13 +55,12 @@ public:
         },
         mFont{font},
         mIcons{icons},
-        mInventoryItems{},
+        mInventoryItems{sColumns * sRows},
         mContainer{nullptr},
         mShowDescription{std::move(showDescription)},
         mLogger{Logging::LogState::GetLogger("Gui::ContainerDisplay")}
     {
         assert(mShowDescription);
-        mInventoryItems.reserve(20);
     }
 
     void SetContainer(BAK::IContainer* container)
@@ -83,8 +86,7 @@ private:
     void UpdateInventoryContents()
     {
         ASSERT(mContainer != nullptr);
-        mInventoryItems.clear();
-        const auto& inventory = mContainer->GetInventory();
+        const auto& inventory = std::as_const(*mContainer).GetInventory();
 
         std::vector<
             std::pair<
@@ -92,7 +94,6 @@ private:
             const BAK::InventoryItem*>> items{};
 
         const auto numItems = inventory.GetItems().size();
-        mInventoryItems.reserve(numItems);
         items.reserve(numItems);
 
         unsigned index{0};
@@ -106,6 +107,7 @@ private:
 
         const auto slotDims = glm::vec2{40, 29};
 
+        mInventoryItems.Begin();
         auto arranger = ItemArranger{};
         if (   mContainer->GetContainerType() == BAK::ContainerType::Shop
             || mContainer->GetContainerType() == BAK::ContainerType::Inn)
@@ -117,7 +119,8 @@ private:
                 true,
                 [&](auto invIndex, const auto& item, const auto itemPos, const auto dims)
                 {
-                    mInventoryItems.emplace_back(
+                    mInventoryItems.Place(
+                        SlotKey{invIndex, item, itemPos, dims},
                         itemPos,
                         dims,
                         mFont,
@@ -141,12 +144,13 @@ private:
 
             arranger.PlaceItems(
                 items.begin(), items.end(),
-                12, 4,
+                sColumns, sRows,
                 slotDims,
                 false,
                 [&](auto invIndex, const auto& item, const auto itemPos, const auto dims)
                 {
-                    mInventoryItems.emplace_back(
+                    mInventoryItems.Place(
+                        SlotKey{invIndex, item, itemPos, dims},
                         itemPos,
                         dims,
                         mFont,
@@ -159,19 +163,21 @@ private:
                         });
                 });
         }
+        mInventoryItems.End();
     }
 
     void AddChildren()
     {
-        for (auto& item : mInventoryItems)
+        mInventoryItems.ForEach([&](auto& item){
             AddChildBack(&item);
+        });
     }
 
 private:
     const Font& mFont;
     const Icons& mIcons;
 
-    std::vector<DraggableItem> mInventoryItems;
+    SlotPool<DraggableItem> mInventoryItems;
 
     BAK::IContainer* mContainer;
 
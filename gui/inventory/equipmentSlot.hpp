@@ -1,6 +1,7 @@
 #pragma once
 
 #include "gui/inventory/inventorySlot.hpp"
+#include "gui/inventory/slotPool.hpp"
 #include "gui/icons.hpp"
 #include "gui/colors.hpp"
 #include "gui/clickButton.hpp"
@@ -28,6 +29,8 @@ public:
             glm::vec4{},
             true
         },
+        mItem{},
+        mKey{},
         mBlank{
             ImageTag{},
             std::get<Graphics::SpriteSheetIndex>(
@@ -64,6 +67,25 @@ public:
         AddChildBack(&(*mItem));
     }
 
+    // Only reconstructs the item widget when it would display
+    // something different to the current one
+    template <typename ...Args>
+    void UpdateItem(const SlotKey& key, Args&&... args)
+    {
+        if (mItem && mKey == key)
+        {
+            mItem->ResetSelected();
+            mItem->UpdateSelected();
+            ClearChildren();
+            AddChildBack(&(*mItem));
+        }
+        else
+        {
+            mKey = key;
+            AddItem(std::forward<Args>(args)...);
+        }
+    }
+
     void ClearItem()
     {
         ClearChildren();
@@ -82,6 +104,7 @@ public:
 
 private:
     std::optional<DraggableItem> mItem;
+    SlotKey mKey;
     Widget mBlank;
 };
 
@@ -65,6 +65,7 @@ InventoryScreen::InventoryScreen(
         mLayout.GetWidgetLocation(mGoldRequest),
         mLayout.GetWidgetDimensions(mGoldRequest),
     },
+    mDisplayedGold{},
     mContainerTypeDisplay{
         [this](auto& item){ SplitStackBeforeMoveItemToContainer(item); },
         mLayout.GetWidgetLocation(mContainerTypeRequest),
@@ -127,7 +128,7 @@ InventoryScreen::InventoryScreen(
         mIcons,
         131
     },
-    mInventoryItems{},
+    mInventoryItems{sInventoryColumns * sInventoryRows},
     mSplitStackDialog{
         {128, 80},
         mFont
@@ -557,7 +558,7 @@ void InventoryScreen::HaggleItem(
     const auto result = BAK::Haggle::TryHaggle(
         mGameState.GetParty(),
         character,
-        mContainer->GetShop(),
+        std::as_const(*mContainer).GetShop(),
         item.GetItemIndex(),
         mShopScreen.GetDiscount(slot.GetItemIndex()).mValue);
 
@@ -766,7 +767,7 @@ void InventoryScreen::SplitStackBeforeMoveItemToContainer(InventorySlot& slot)
     // Game doesn't split stacks when selling to shops
     if (slot.GetItem().IsStackable() && !mContainer->IsShop())
     {
-        const auto maxAmount = mContainer->GetInventory()
+        const auto maxAmount = std::as_const(*mContainer).GetInventory()
             .CanAddContainer(slot.GetItem());
 
         mSplitStackDialog.BeginSplitDialog(
@@ -928,10 +929,38 @@ void InventoryScreen::UnhighlightDrops()
 
 void InventoryScreen::UpdatePartyMembers()
 {
-    mCharacters.clear();
-
     const auto& party = mGameState.GetParty();
+
+    std::vector<BAK::CharIndex> members{};
     BAK::ActiveCharIndex person{0};
+    do
+    {
+        members.emplace_back(party.GetCharacter(person).GetIndex());
+        person = party.NextActiveCharacter(person);
+    } while (person != BAK::ActiveCharIndex{0});
+
+    // The portraits only need rebuilding when the party changes
+    if (members == mPartyMembers)
+    {
+        for (unsigned i = 0; i < mCharacters.size(); i++)
+        {
+            if (BAK::ActiveCharIndex{i} != mSelectedCharacter)
+            {
+                mCharacters[i].SetColor(glm::vec4{.05, .05, .05, 1}); 
+                mCharacters[i].SetColorMode(Graphics::ColorMode::TintColor);
+            }
+            else
+            {
+                mCharacters[i].SetColor(glm::vec4{1});
+                mCharacters[i].SetColorMode(Graphics::ColorMode::Texture);
+            }
+        }
+        return;
+    }
+
+    mPartyMembers = std::move(members);
+    mCharacters.clear();
+
     do
     {
         const auto [spriteSheet, image, _] = mIcons.GetCharacterHead(
@@ -968,6 +997,10 @@ void InventoryScreen::UpdatePartyMembers()
 void InventoryScreen::UpdateGold()
 {
     const auto gold = mGameState.GetParty().GetGold();
+    if (mDisplayedGold == gold)
+        return;
+    mDisplayedGold = gold;
+
     const auto text = ToString(gold);
     const auto [textDims, _] = mGoldDisplay.SetText(mFont, text);
 
@@ -993,14 +1026,10 @@ void InventoryScreen::UpdateInventoryContents()
         }
         else
         {
-            return GetCharacter(*mSelectedCharacter).GetInventory();
+            return std::as_const(GetCharacter(*mSelectedCharacter)).GetInventory();
         }
     });
 
-
-    mInventoryItems.clear();
-    mInventoryItems.reserve(inventory.GetNumberItems());
-
     std::vector<
         std::pair<
             BAK::InventoryIndex,
@@ -1045,7 +1074,8 @@ void InventoryScreen::UpdateInventoryContents()
                 mWeapon.SetDimensions({80, 29});
             }
 
-            mWeapon.AddItem(
+            mWeapon.UpdateItem(
+                SlotKey{invIndex, item, glm::vec2{0}, scale},
                 glm::vec2{0},
                 scale,
                 mFont,
@@ -1064,7 +1094,8 @@ void InventoryScreen::UpdateInventoryContents()
         if (item.IsItemType(BAK::ItemType::Crossbow)
             && item.IsEquipped())
         {
-            mCrossbow.AddItem(
+            mCrossbow.UpdateItem(
+                SlotKey{invIndex, item, glm::vec2{0}, slotDims * glm::vec2{2, 1}},
                 glm::vec2{0},
                 slotDims * glm::vec2{2, 1},
                 mFont,
@@ -1082,7 +1113,8 @@ void InventoryScreen::UpdateInventoryContents()
         if (item.IsItemType(BAK::ItemType::Armor)
             && item.IsEquipped())
         {
-            mArmor.AddItem(
+            mArmor.UpdateItem(
+                SlotKey{invIndex, item, glm::vec2{0}, slotDims * glm::vec2{2}},
                 glm::vec2{0},
                 slotDims * glm::vec2{2},
                 mFont,
@@ -1117,17 +1149,19 @@ void InventoryScreen::UpdateInventoryContents()
     });
 
     const auto pos  = glm::vec2{105, 11};
+    mInventoryItems.Begin();
     auto arranger = ItemArranger{};
     arranger.PlaceItems(
         items.begin(),
         items.end(),
-        6,
-        4,
+        sInventoryColumns,
+        sInventoryRows,
         slotDims,
         false,
         [&](auto invIndex, const auto& item, const auto itemPos, const auto dims)
         {
-            mInventoryItems.emplace_back(
+            mInventoryItems.Place(
+                SlotKey{invIndex, item, itemPos + pos, dims},
                 [this, index=invIndex](auto& item){
                     this->UseItem(item, BAK::InventoryIndex{index}); },
                 itemPos + pos,
@@ -1141,6 +1175,7 @@ void InventoryScreen::UpdateInventoryContents()
                     ShowItemDescription(item);
                 });
         });
+    mInventoryItems.End();
 }
 
 void InventoryScreen::AddChildren()
@@ -1174,8 +1209,9 @@ void InventoryScreen::AddChildren()
 
         AddChildBack(&mArmor);
 
-        for (auto& item : mInventoryItems)
+        mInventoryItems.ForEach([&](auto& item){
             AddChildBack(&item);
+        });
     }
     else if (mDisplayContainer)
     {
@@ -1212,9 +1248,9 @@ void InventoryScreen::HandleItemSelected()
         return false;
     };
 
-    for (auto& item : mInventoryItems)
+    for (std::size_t i = 0; i < mInventoryItems.size(); i++)
     {
-        if (checkItem(item))
+        if (checkItem(mInventoryItems[i]))
             return;
     }
 
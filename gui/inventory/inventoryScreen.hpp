@@ -15,6 +15,7 @@
 #include "gui/inventory/inventorySlot.hpp"
 #include "gui/inventory/itemArranger.hpp"
 #include "gui/inventory/shopDisplay.hpp"
+#include "gui/inventory/slotPool.hpp"
 #include "gui/inventory/splitStackDialog.hpp"
 
 #include "gui/IDialogScene.hpp"
@@ -182,6 +183,9 @@ private:
     void HandleItemSelected();
 
 private:
+    static constexpr auto sInventoryColumns = 6;
+    static constexpr auto sInventoryRows = 4;
+
     IGuiManager& mGuiManager;
     const Font& mFont;
     const Icons& mIcons;
@@ -201,9 +205,12 @@ private:
         std::function<void()>>;
 
     std::vector<ItemEndpoint<CharacterButton>> mCharacters;
+    // Characters mCharacters was built for
+    std::vector<BAK::CharIndex> mPartyMembers;
     ClickButtonImage mNextPage;
     ClickButtonImage mExit;
     TextBox mGoldDisplay;
+    std::optional<BAK::Royals> mDisplayedGold;
     // click into shop or keys, etc.
     ItemEndpoint<ClickButtonImage> mContainerTypeDisplay;
 
@@ -216,7 +223,7 @@ private:
     ItemEndpointEquipmentSlot mWeapon;
     ItemEndpointEquipmentSlot mCrossbow;
     ItemEndpointEquipmentSlot mArmor;
-    std::vector<ItemEndpoint<DraggableItem>> mInventoryItems;
+    SlotPool<ItemEndpoint<DraggableItem>> mInventoryItems;
     SplitStackDialog mSplitStackDialog;
 
     std::optional<BAK::ActiveCharIndex> mSelectedCharacter;
@@ -10,6 +10,7 @@
 #include "gui/inventory/equipmentSlot.hpp"
 #include "gui/inventory/itemArranger.hpp"
 #include "gui/inventory/shopItemSlot.hpp"
+#include "gui/inventory/slotPool.hpp"
 
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
@@ -55,7 +56,7 @@ public:
         mFont{font},
         mIcons{icons},
         mShopPage{0},
-        mInventoryItems{},
+        mInventoryItems{mItemsPerPage},
         mDiscount{},
         mContainer{nullptr},
         mShowDescription{std::move(showDescription)},
@@ -88,7 +89,7 @@ public:
     std::size_t GetMaxPages()
     {
         ASSERT(mContainer);
-        const auto nItems = mContainer->GetInventory().GetNumberItems();
+        const auto nItems = std::as_const(*mContainer).GetInventory().GetNumberItems();
         const auto fullPages = nItems / mItemsPerPage;
         const auto partialPages = (nItems % mItemsPerPage) != 0;
         return fullPages + partialPages;
@@ -99,15 +100,15 @@ public:
         unsigned amount)
     {
         ASSERT(mContainer);
-        auto item = mContainer->GetInventory().GetAtIndex(itemIndex);
+        auto item = std::as_const(*mContainer).GetInventory().GetAtIndex(itemIndex);
         item.SetQuantity(amount);
-        return BAK::Shop::GetSellPrice(item, mContainer->GetShop(), mDiscount[item.GetItemIndex()]);
+        return BAK::Shop::GetSellPrice(item, std::as_const(*mContainer).GetShop(), mDiscount[item.GetItemIndex()]);
     }
 
     BAK::Royals GetBuyPrice(const BAK::InventoryItem& item) const
     {
         ASSERT(mContainer);
-        return BAK::Shop::GetBuyPrice(item, mContainer->GetShop());
+        return BAK::Shop::GetBuyPrice(item, std::as_const(*mContainer).GetShop());
     }
 
     bool CanBuyItem(const BAK::InventoryItem& item) const
@@ -120,14 +121,14 @@ public:
     {
         mLogger.Debug() << " Setting discount to: " << discount << "\n";
         ASSERT(mContainer);
-        const auto& item = mContainer->GetInventory().GetAtIndex(itemIndex);
+        const auto& item = std::as_const(*mContainer).GetInventory().GetAtIndex(itemIndex);
         mDiscount[item.GetItemIndex()] = discount;
     }
 
     BAK::Royals GetDiscount(BAK::InventoryIndex itemIndex)
     {
         ASSERT(mContainer);
-        const auto& item = mContainer->GetInventory().GetAtIndex(itemIndex);
+        const auto& item = std::as_const(*mContainer).GetInventory().GetAtIndex(itemIndex);
         return mDiscount[item.GetItemIndex()];
     }
 
@@ -141,15 +142,14 @@ private:
     void ClearDiscounts()
     {
         mDiscount.clear();
-        const auto& inventory = mContainer->GetInventory();
+        const auto& inventory = std::as_const(*mContainer).GetInventory();
     }
 
     void UpdateInventoryContents()
     {
         ASSERT(mContainer != nullptr);
-        mInventoryItems.clear();
 
-        const auto& inventory = mContainer->GetInventory();
+        const auto& inventory = std::as_const(*mContainer).GetInventory();
 
         std::vector<
             std::pair<
@@ -157,7 +157,6 @@ private:
             const BAK::InventoryItem*>> items{};
 
         const auto numItems = inventory.GetItems().size();
-        mInventoryItems.reserve(numItems);
         items.reserve(numItems);
 
         unsigned index{0};
@@ -168,6 +167,7 @@ private:
                 return std::make_pair(BAK::InventoryIndex{index++}, &i);
             });
 
+        mInventoryItems.Begin();
         auto arranger = ItemArranger{};
         if (   mContainer->GetContainerType() == BAK::ContainerType::Shop
             || mContainer->GetContainerType() == BAK::ContainerType::Inn  )
@@ -190,26 +190,34 @@ private:
                 [&](auto invIndex, const auto& item, const auto itemPos, const auto dims)
                 {
                     const auto discount = mDiscount[item.GetItemIndex()];
-                    mInventoryItems.emplace_back(
+                    const auto sellPrice = BAK::Shop::GetSellPrice(
+                        item, std::as_const(*mContainer).GetShop(), discount);
+                    const bool available = discount != BAK::sUnpurchaseablePrice;
+                    mInventoryItems.Place(
+                        SlotKey{
+                            invIndex, item, itemPos, dims,
+                            (sellPrice.mValue << 1) | available},
                         itemPos,
                         dims,
                         mFont,
                         mIcons,
                         invIndex,
                         item,
-                        BAK::Shop::GetSellPrice(item, mContainer->GetShop(), discount),
-                        discount != BAK::sUnpurchaseablePrice,
+                        sellPrice,
+                        available,
                         [&]{
                             ShowItemDescription(item);
                         });
                 });
         }
+        mInventoryItems.End();
     }
 
     void AddChildren()
     {
-        for (auto& item : mInventoryItems)
+        mInventoryItems.ForEach([&](auto& item){
             AddChildBack(&item);
+        });
     }
 
 private:
@@ -217,7 +225,7 @@ private:
     const Icons& mIcons;
 
     unsigned mShopPage;
-    std::vector<DraggableShopItem> mInventoryItems;
+    SlotPool<DraggableShopItem> mInventoryItems;
     std::unordered_map<BAK::ItemIndex, BAK::Royals> mDiscount;
 
     BAK::IContainer* mContainer;
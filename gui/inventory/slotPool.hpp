@@ -0,0 +1,138 @@
+#pragma once
+
+#include "bak/inventory.hpp"
+#include "bak/inventoryItem.hpp"
+
+#include "com/assert.hpp"
+
+#include <glm/glm.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace Gui {
+
+// Everything an inventory slot widget displays. Two slots with
+// equal keys render identically so the widget can be reused.
+struct SlotKey
+{
+    SlotKey() = default;
+
+    SlotKey(
+        BAK::InventoryIndex index,
+        const BAK::InventoryItem& item,
+        glm::vec2 position,
+        glm::vec2 dims,
+        unsigned extra = 0)
+    :
+        mIndex{index},
+        mItem{&item},
+        mItemIndex{item.GetItemIndex()},
+        mCondition{item.GetCondition()},
+        mStatus{item.GetStatus()},
+        mModifiers{item.GetModifierMask()},
+        mPosition{position},
+        mDims{dims},
+        mExtra{extra}
+    {}
+
+    bool operator==(const SlotKey&) const = default;
+
+    BAK::InventoryIndex mIndex;
+    // Slots hold a reference to the item so a slot can only be
+    // reused while the item has not moved in memory.
+    const BAK::InventoryItem* mItem;
+    BAK::ItemIndex mItemIndex;
+    unsigned mCondition;
+    std::uint8_t mStatus;
+    std::uint8_t mModifiers;
+    glm::vec2 mPosition;
+    glm::vec2 mDims;
+    // Anything else the slot displays, e.g. a shop price
+    unsigned mExtra;
+};
+
+// Fixed capacity storage for InventorySlot derived widgets that
+// survives refreshes. Between Begin and End the owner places each
+// slot it wants displayed; a slot is only reconstructed when its
+// key differs from the one previously placed at that position.
+// Widgets are never moved so child pointers into them stay valid.
+template <typename SlotT>
+class SlotPool
+{
+public:
+    explicit SlotPool(std::size_t capacity)
+    :
+        mSlots(capacity),
+        mKeys(capacity),
+        mUsed{0},
+        mNext{0},
+        mRebuilt{0}
+    {}
+
+    void Begin()
+    {
+        mNext = 0;
+        mRebuilt = 0;
+    }
+
+    template <typename ...Args>
+    SlotT& Place(const SlotKey& key, Args&&... args)
+    {
+        ASSERT(mNext < mSlots.size());
+        auto& slot = mSlots[mNext];
+        if (!slot || mKeys[mNext] != key)
+        {
+            slot.emplace(std::forward<Args>(args)...);
+            mKeys[mNext] = key;
+            mRebuilt++;
+        }
+        else
+        {
+            // A fresh slot is never selected
+            slot->ResetSelected();
+            slot->UpdateSelected();
+        }
+
+        mNext++;
+        return *slot;
+    }
+
+    void End()
+    {
+        for (auto i = mNext; i < mUsed; i++)
+            mSlots[i].reset();
+        mUsed = mNext;
+    }
+
+    void Clear()
+    {
+        Begin();
+        End();
+    }
+
+    std::size_t size() const { return mUsed; }
+    std::size_t GetRebuilt() const { return mRebuilt; }
+
+    SlotT& operator[](std::size_t i)
+    {
+        ASSERT(i < mUsed && mSlots[i]);
+        return *mSlots[i];
+    }
+
+    template <typename F>
+    void ForEach(F&& f)
+    {
+        for (std::size_t i = 0; i < mUsed; i++)
+            f(*mSlots[i]);
+    }
+
+private:
+    std::vector<std::optional<SlotT>> mSlots;
+    std::vector<SlotKey> mKeys;
+    std::size_t mUsed;
+    std::size_t mNext;
+    std::size_t mRebuilt;
+};
+
+}
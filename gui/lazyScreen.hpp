@@ -0,0 +1,48 @@
+#pragma once
+
+#include "com/assert.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace Gui {
+
+// Owns a screen that is only constructed, and so only loads its sprite
+// sheets, the first time it is used
+template <typename T>
+class LazyScreen
+{
+public:
+    using Factory = std::function<std::unique_ptr<T>()>;
+
+    explicit LazyScreen(Factory&& factory)
+    :
+        mFactory{std::move(factory)},
+        mScreen{}
+    {
+        ASSERT(mFactory);
+    }
+
+    T& Get()
+    {
+        if (!mScreen)
+        {
+            mScreen = mFactory();
+            ASSERT(mScreen);
+        }
+        return *mScreen;
+    }
+
+    T* operator->() { return &Get(); }
+    T& operator*() { return Get(); }
+
+    bool IsLoaded() const { return mScreen != nullptr; }
+    T* GetIfLoaded() { return mScreen.get(); }
+    const T* GetIfLoaded() const { return mScreen.get(); }
+
+private:
+    Factory mFactory;
+    std::unique_ptr<T> mScreen;
+};
+
+}
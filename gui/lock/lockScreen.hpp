@@ -183,7 +183,7 @@ public:
         mContainer = container;
 
         mLock.SetImageBasedOnLockType(
-            BAK::ClassifyLock(container->GetLock().mRating));
+            BAK::ClassifyLock(std::as_const(*container).GetLock().mRating));
         mLock.SetLocked();
         ResetUnlocked();
 
@@ -249,7 +249,7 @@ private:
         unsigned context = 0;
         auto dialog = BAK::DialogSources::mLockDialog;
 
-        const auto lockRating = mContainer->GetLock().mRating;
+        const auto lockRating = std::as_const(*mContainer).GetLock().mRating;
         const auto lockIndex = BAK::GetLockIndex(lockRating);
         const auto lockpickSkill = GetCharacter(*mSelectedCharacter)
             .GetSkill(BAK::SkillType::Lockpick);
@@ -298,7 +298,7 @@ private:
         ASSERT(item.IsKey());
         const auto& skill = GetCharacter(*mSelectedCharacter)
             .GetSkill(BAK::SkillType::Lockpick);
-        const auto lockRating = mContainer->GetLock().mRating;
+        const auto lockRating = std::as_const(*mContainer).GetLock().mRating;
 
         if (item.GetItemIndex() == BAK::sPicklock)
         {
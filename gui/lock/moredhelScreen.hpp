@@ -134,7 +134,7 @@ public:
 
         mContainer = container;
         const auto& snippet = BAK::DialogSources::GetFairyChestKey(
-            container->GetLock().mFairyChestIndex);
+            std::as_const(*container).GetLock().mFairyChestIndex);
         mFairyChest = BAK::GenerateFairyChest(
             std::string{BAK::DialogStore::Get().GetSnippet(snippet).GetText()});
 
@@ -3,10 +3,12 @@
 #include "audio/audio.hpp"
 
 #include "bak/IContainer.hpp"
+#include "bak/saveWriter.hpp"
 #include "bak/textureFactory.hpp"
 
 #include "gui/IDialogScene.hpp"
 #include "gui/IGuiManager.hpp"
+#include "gui/animator.hpp"
 #include "gui/backgrounds.hpp"
 #include "gui/colors.hpp"
 #include "gui/clickButton.hpp"
@@ -107,7 +109,12 @@ public:
             [this]{ 
                 mGuiManager.DoFade(
                     1.0,
-                    []{ std::exit(0); });
+                    []{
+                        // Don't quit with a save still being written
+                        BAK::SaveWriter::Get().Flush();
+                        BAK::SaveWriter::Get().PollCompleted();
+                        std::exit(0);
+                    });
             }
         },
         mCancel{
@@ -147,6 +154,7 @@ public:
         },
         mState{State::MainMenu},
         mGameRunning{false},
+        mPollingSaves{false},
         mLogger{Logging::LogState::GetLogger("Gui::MainMenuScreen")}
     {
     }
@@ -196,6 +204,19 @@ private:
             mState = State::Save;
             mSaveScreen.SetSaveOrLoad(isSave);
             AddChildren();
+            if (!mPollingSaves)
+            {
+                mPollingSaves = true;
+                // Stops once the refresh is done or the save screen is left,
+                // the next SetSaveOrLoad picks up anything still pending
+                mGuiManager.AddAnimator(
+                    std::make_unique<PollAnimator>(
+                        [this]{
+                            mPollingSaves = mState == State::Save
+                                && mSaveScreen.PollSaves();
+                            return mPollingSaves;
+                        }));
+            }
         });
     }
 
@@ -306,6 +327,7 @@ private:
 
     State mState;
     bool mGameRunning;
+    bool mPollingSaves;
 
     const Logging::Logger& mLogger;
 };
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "bak/coordinates.hpp"
+#include "bak/gameState.hpp"
 #include "bak/hotspot.hpp"
+#include "bak/IGameStateListener.hpp"
 #include "bak/layout.hpp"
 #include "bak/scene.hpp"
 #include "bak/sceneData.hpp"
@@ -28,7 +30,7 @@
 
 namespace Gui {
 
-class MainView : public Widget
+class MainView : public Widget, public BAK::IGameStateListener
 {
 public:
     static constexpr auto sLayoutFile = "REQ_MAIN.DAT";
@@ -45,6 +47,7 @@ public:
 
     MainView(
         IGuiManager& guiManager,
+        BAK::GameState& gameState,
         const Backgrounds& backgrounds,
         const Icons& icons)
     :
@@ -59,6 +62,7 @@ public:
             true
         },
         mGuiManager{guiManager},
+        mGameState{gameState},
         mIcons{icons},
         mLayout{sLayoutFile},
         mCompass{
@@ -71,6 +75,7 @@ public:
         },
         mButtons{},
         mCharacters{},
+        mPartyDirty{true},
         mLogger{Logging::LogState::GetLogger("Gui::MainView")}
     {
         mButtons.reserve(mLayout.GetSize());
@@ -110,11 +115,30 @@ public:
         }
 
         AddChildren();
+        mGameState.AddListener(this);
     }
 
-    void SetHeading(BAK::GameHeading heading)
+    MainView(const MainView&) = delete;
+    MainView& operator=(const MainView&) = delete;
+
+    ~MainView()
+    {
+        mGameState.RemoveListener(this);
+    }
+
+    void OnGameStateChanged(BAK::GameStateChange::Mask changes) override
     {
-        mCompass.SetHeading(heading);
+        using namespace BAK::GameStateChange;
+        if (changes & Heading)
+            mCompass.SetHeading(mGameState.GetLocation().mHeading);
+
+        if (changes & Party)
+        {
+            mPartyDirty = true;
+            // The portraits are rebuilt when the view is next shown
+            if (mParent != nullptr)
+                UpdatePartyMembers();
+        }
     }
 
     void AddChildren()
@@ -150,14 +174,18 @@ public:
         }
     }
 
-    void UpdatePartyMembers(const BAK::GameState& gameState)
+    void UpdatePartyMembers()
     {
+        if (!mPartyDirty)
+            return;
+        mPartyDirty = false;
+
         ClearChildren();
 
         mCharacters.clear();
         mCharacters.reserve(3);
 
-        const auto& party = gameState.GetParty();
+        const auto& party = std::as_const(mGameState).GetParty();
         mLogger.Info() << "Updating Party: " << party<< "\n";
         BAK::ActiveCharIndex person{0};
         do
@@ -196,6 +224,7 @@ public:
 
 private:
     IGuiManager& mGuiManager;
+    BAK::GameState& mGameState;
     const Icons& mIcons;
 
     BAK::Layout mLayout;
@@ -203,6 +232,7 @@ private:
     Compass mCompass;
     std::vector<ClickButtonImage> mButtons;
     std::vector<ClickButtonImage> mCharacters;
+    bool mPartyDirty;
 
     const Logging::Logger& mLogger;
 };
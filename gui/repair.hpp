@@ -45,7 +45,7 @@ public:
     Repair& operator=(const Repair&) = delete;
 
     void EnterRepair(
-        BAK::ShopStats& shopStats)
+        const BAK::ShopStats& shopStats)
     {
         mShopStats = &shopStats;
         mState = State::Idle;
@@ -124,7 +124,7 @@ private:
     IGuiManager& mGuiManager;
 
     BAK::InventoryItem* mItem;
-    BAK::ShopStats* mShopStats;
+    const BAK::ShopStats* mShopStats;
 
     const Logging::Logger& mLogger;
 };
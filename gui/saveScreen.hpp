@@ -13,6 +13,7 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
 #include <iomanip>
 #include <filesystem>
 #include <functional>
@@ -146,6 +147,7 @@ public:
         mRefreshSaves{false},
         mSelectedDirectory{},
         mSelectedSave{},
+        mSelection{},
         mSaveManager{(GetBakDirectoryPath() / "GAMES").string()},
         mNeedRefresh{false},
         mLogger{Logging::LogState::GetLogger("Gui::SaveScreen")}
@@ -169,41 +171,49 @@ public:
 
     void SetSaveOrLoad(bool isSave)
     {
-        mSaveManager.RefreshSaves();
+        mSaveManager.RefreshSavesAsync();
+        mSaveManager.PollSaves();
 
         mIsSave = isSave;
         mDirectories.SetDimensions(glm::vec2{100, mIsSave ? 90 : 108});
         mFiles.SetDimensions(glm::vec2{160, mIsSave ? 90 : 108});
 
-        if (!mSelectedDirectory || !mSelectedSave)
+        ResolveSelection();
+        UpdateSaveInputs();
+
+        mRefreshSaves = true;
+        mRefreshDirectories = true;
+        RefreshGui();
+    }
+
+    // Picks up save directories as the save manager finds them.
+    // Returns true while the refresh is still running.
+    bool PollSaves()
+    {
+        if (mSaveManager.PollSaves())
         {
-            if (mSaveManager.GetSaves().size() > 0)
+            // Directories can be inserted ahead of the selected one, so
+            // find it again. Only replace the inputs if it's gone so
+            // that what the user is typing isn't lost.
+            if (ResolveSelection())
             {
-                mSelectedDirectory = 0;
-                if (mSaveManager.GetSaves().at(*mSelectedDirectory).mSaves.size() > 0)
-                {
-                    mSelectedSave = 0;
-                }
+                UpdateSaveInputs();
+                mRefreshSaves = true;
             }
+            RefreshGui();
         }
 
-        mDirectorySaveInput.SetText(
-            mSelectedDirectory
-                ? mSaveManager.GetSaves().at(*mSelectedDirectory).mName
-                : "");
-
-        mFileSaveInput.SetText(
-            (mSelectedDirectory && mSelectedSave)
-                ? mSaveManager.GetSaves().at(*mSelectedDirectory).mSaves.at(*mSelectedSave).mName
-                : "");
-
-        mRefreshSaves = true;
-        mRefreshDirectories = true;
-        RefreshGui();
+        return mSaveManager.IsRefreshing();
     }
 
 private:
     void RemoveDirectory()
+    {
+        if (FinishRefresh())
+            RemoveSelectedDirectory();
+    }
+
+    void RemoveSelectedDirectory()
     {
         if (!mSelectedDirectory)
             return;
@@ -213,12 +223,14 @@ private:
         {
             (*mSelectedDirectory)--;
         }
+        UpdateSelection();
+        RememberSelection();
         RefreshGui();
     }
 
     void RemoveFile()
     {
-        if (!mSelectedSave)
+        if (!FinishRefresh() || !mSelectedSave)
             return;
 
         assert(mSelectedDirectory);
@@ -233,8 +245,10 @@ private:
         }
         if (mSaveManager.GetSaves().at(*mSelectedDirectory).mSaves.size() == 0)
         {
-            RemoveDirectory();
+            RemoveSelectedDirectory();
         }
+        UpdateSelection();
+        RememberSelection();
         RefreshGui();
     }
 
@@ -254,7 +268,9 @@ private:
 
     void RestoreGame()
     {
-        assert(mSelectedDirectory && mSelectedSave);
+        if (!mSelectedDirectory || !mSelectedSave)
+            return;
+
         const auto savePath = mSaveManager.GetSaves().at(*mSelectedDirectory)
             .mSaves.at(*mSelectedSave).mPath;
         std::invoke(mLoadSaveFn, savePath);
@@ -275,6 +291,7 @@ private:
         mFileSaveInput.SetText(saves.size() > 0
                 ? saves.front().mName
                 : "");
+        RememberSelection();
 
         mNeedRefresh = true;
         mRefreshSaves = true;
@@ -290,10 +307,119 @@ private:
         mFileSaveInput.SetFocus(true);
         const auto saveName = saves.at(*mSelectedSave).mName;
         mFileSaveInput.SetText(saveName);
+        RememberSelection();
 
         mNeedRefresh = true;
     }
 
+    // Keeps the selection in range, selecting the first directory and
+    // save where nothing is selected
+    void UpdateSelection()
+    {
+        const auto& saves = mSaveManager.GetSaves();
+        if (mSelectedDirectory && *mSelectedDirectory >= saves.size())
+        {
+            mSelectedDirectory.reset();
+            mSelectedSave.reset();
+        }
+
+        if (!mSelectedDirectory && saves.size() > 0)
+        {
+            mSelectedDirectory = 0;
+            mSelectedSave.reset();
+        }
+
+        if (mSelectedDirectory)
+        {
+            const auto& files = saves.at(*mSelectedDirectory).mSaves;
+            if (mSelectedSave && *mSelectedSave >= files.size())
+            {
+                mSelectedSave.reset();
+            }
+            if (!mSelectedSave && files.size() > 0)
+            {
+                mSelectedSave = 0;
+            }
+        }
+    }
+
+    void RememberSelection()
+    {
+        if (!mSelectedDirectory)
+        {
+            mSelection.reset();
+            return;
+        }
+
+        const auto& directory = mSaveManager.GetSaves().at(*mSelectedDirectory);
+        mSelection = Selection{
+            directory.mIndex,
+            directory.mName,
+            mSelectedSave
+                ? directory.mSaves.at(*mSelectedSave).mPath
+                : std::string{}};
+    }
+
+    // Finds the selected directory and save again after the save list
+    // has changed, selecting the defaults in place of any that are
+    // gone. Returns true if a different entry is now selected.
+    bool ResolveSelection()
+    {
+        const auto previous = mSelection;
+        mSelectedDirectory.reset();
+        mSelectedSave.reset();
+
+        if (mSelection)
+        {
+            const auto& saves = mSaveManager.GetSaves();
+            const auto dir = std::find_if(saves.begin(), saves.end(),
+                [&](const auto& elem){
+                    return elem.mIndex == mSelection->mDirectoryIndex
+                        && elem.mName == mSelection->mDirectoryName;
+                });
+            if (dir != saves.end())
+            {
+                mSelectedDirectory = std::distance(saves.begin(), dir);
+                const auto save = std::find_if(dir->mSaves.begin(), dir->mSaves.end(),
+                    [&](const auto& elem){ return elem.mPath == mSelection->mSavePath; });
+                if (save != dir->mSaves.end())
+                    mSelectedSave = std::distance(dir->mSaves.begin(), save);
+            }
+        }
+
+        UpdateSelection();
+        RememberSelection();
+        return mSelection != previous;
+    }
+
+    // Removing waits for the background refresh, which may move or
+    // drop the selected entry. Returns false if it was dropped.
+    bool FinishRefresh()
+    {
+        mSaveManager.WaitForRefresh();
+        if (ResolveSelection())
+        {
+            UpdateSaveInputs();
+            mRefreshSaves = true;
+            RefreshGui();
+            return false;
+        }
+        return true;
+    }
+
+    void UpdateSaveInputs()
+    {
+        mDirectorySaveInput.SetText(
+            mSelectedDirectory
+                ? mSaveManager.GetSaves().at(*mSelectedDirectory).mName
+                : "");
+
+        mFileSaveInput.SetText(
+            (mSelectedDirectory && mSelectedSave)
+                ? mSaveManager.GetSaves().at(*mSelectedDirectory).mSaves.at(*mSelectedSave).mName
+                : "");
+    }
+
     void RefreshGui()
     {
         mNeedRefresh = false;
@@ -406,10 +532,21 @@ private:
     ClickButton mRestore;
     ClickButton mCancel;
 
+    // Identifies the selection independently of list positions
+    struct Selection
+    {
+        unsigned mDirectoryIndex;
+        std::string mDirectoryName;
+        std::string mSavePath;
+
+        bool operator==(const Selection&) const = default;
+    };
+
     bool mRefreshDirectories;
     bool mRefreshSaves;
     std::optional<std::size_t> mSelectedDirectory;
     std::optional<std::size_t> mSelectedSave;
+    std::optional<Selection> mSelection;
     BAK::SaveManager mSaveManager;
 
     bool mNeedRefresh;
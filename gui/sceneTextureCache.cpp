@@ -0,0 +1,88 @@
+#include "gui/sceneTextureCache.hpp"
+
+#include "bak/textureFactory.hpp"
+
+#include "com/assert.hpp"
+
+#include <algorithm>
+
+namespace Gui {
+
+SceneTextures::SceneTextures(
+    Graphics::SpriteManager& spriteManager,
+    const std::vector<SceneImage>& images)
+:
+    mSpriteManager{spriteManager},
+    mSpriteSheet{spriteManager.AddSpriteSheet()},
+    mTextures{},
+    mOffsets{}
+{
+    mOffsets.reserve(images.size());
+    for (const auto& [image, palette] : images)
+    {
+        mOffsets.emplace_back(mTextures.GetTextures().size());
+        if (image.ends_with(".SCX"))
+            BAK::TextureFactory::AddScreenToTextureStore(mTextures, image, palette);
+        else
+            BAK::TextureFactory::AddToTextureStore(mTextures, image, palette);
+    }
+
+    mSpriteManager
+        .GetSpriteSheet(mSpriteSheet)
+        .LoadTexturesGL(mTextures);
+}
+
+SceneTextures::~SceneTextures()
+{
+    mSpriteManager.RemoveSpriteSheet(mSpriteSheet);
+}
+
+SceneTextureCache::SceneTextureCache(Graphics::SpriteManager& spriteManager)
+:
+    mSpriteManager{spriteManager},
+    mCache{},
+    mRecent{},
+    mHits{0},
+    mMisses{0},
+    mLogger{Logging::LogState::GetLogger("Gui::SceneTextureCache")}
+{}
+
+std::shared_ptr<const SceneTextures> SceneTextureCache::GetTextures(
+    const std::vector<SceneImage>& images)
+{
+    std::erase_if(mCache, [](const auto& entry){ return entry.second.expired(); });
+
+    auto textures = std::shared_ptr<const SceneTextures>{};
+    if (auto it = mCache.find(images); it != mCache.end())
+    {
+        mHits++;
+        textures = it->second.lock();
+        ASSERT(textures);
+    }
+    else
+    {
+        mMisses++;
+        textures = std::make_shared<const SceneTextures>(mSpriteManager, images);
+        mCache.emplace(images, textures);
+        mLogger.Debug() << "Loaded " << images.size() << " images to sheet "
+            << textures->GetSpriteSheet() << " hits: " << mHits
+            << " misses: " << mMisses << "\n";
+    }
+
+    // Most recent at the front
+    if (auto it = std::find(mRecent.begin(), mRecent.end(), textures); it != mRecent.end())
+        mRecent.erase(it);
+    mRecent.emplace_front(textures);
+    if (mRecent.size() > sKeepAlive)
+        mRecent.pop_back();
+
+    return textures;
+}
+
+void SceneTextureCache::Trim()
+{
+    mRecent.clear();
+    std::erase_if(mCache, [](const auto& entry){ return entry.second.expired(); });
+}
+
+}
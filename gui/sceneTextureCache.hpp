@@ -0,0 +1,87 @@
+#pragma once
+
+#include "com/logger.hpp"
+
+#include "graphics/sprites.hpp"
+#include "graphics/texture.hpp"
+#include "graphics/types.hpp"
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Gui {
+
+// An image file and the palette to load it with. SCX files are
+// loaded as whole screens, anything else as a BMX.
+struct SceneImage
+{
+    std::string mImage;
+    std::string mPalette;
+
+    auto operator<=>(const SceneImage&) const = default;
+};
+
+// A sprite sheet holding a list of scene images. The sheet is
+// released back to the SpriteManager when this is destroyed.
+class SceneTextures
+{
+public:
+    SceneTextures(
+        Graphics::SpriteManager& spriteManager,
+        const std::vector<SceneImage>& images);
+
+    SceneTextures(const SceneTextures&) = delete;
+    SceneTextures& operator=(const SceneTextures&) = delete;
+
+    ~SceneTextures();
+
+    Graphics::SpriteSheetIndex GetSpriteSheet() const { return mSpriteSheet; }
+    const Graphics::TextureStore& GetTextures() const { return mTextures; }
+    // Index of the first texture of the i'th requested image
+    unsigned GetOffset(unsigned i) const { return mOffsets.at(i); }
+
+private:
+    Graphics::SpriteManager& mSpriteManager;
+    Graphics::SpriteSheetIndex mSpriteSheet;
+    Graphics::TextureStore mTextures;
+    std::vector<unsigned> mOffsets;
+};
+
+// Hands out shared SceneTextures keyed on the images they contain so
+// scenes showing the same images share one sprite sheet. Sheets stay
+// alive while anything uses them, and the most recently requested
+// are kept a while longer so that revisiting a scene doesn't reload
+// it.
+class SceneTextureCache
+{
+public:
+    static constexpr auto sKeepAlive = 8;
+
+    explicit SceneTextureCache(Graphics::SpriteManager& spriteManager);
+
+    SceneTextureCache(const SceneTextureCache&) = delete;
+    SceneTextureCache& operator=(const SceneTextureCache&) = delete;
+
+    std::shared_ptr<const SceneTextures> GetTextures(
+        const std::vector<SceneImage>& images);
+
+    // Drop the sheets kept alive for revisits
+    void Trim();
+
+    std::size_t GetHits() const { return mHits; }
+    std::size_t GetMisses() const { return mMisses; }
+
+private:
+    Graphics::SpriteManager& mSpriteManager;
+    std::map<std::vector<SceneImage>, std::weak_ptr<const SceneTextures>> mCache;
+    std::deque<std::shared_ptr<const SceneTextures>> mRecent;
+    std::size_t mHits;
+    std::size_t mMisses;
+
+    const Logging::Logger& mLogger;
+};
+
+}
@@ -7,11 +7,20 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <variant>
+#include <vector>
 
 namespace Gui {
 
+// Whether a screen draws over the entire window. Nothing below a
+// Full screen - other screens or the 3D world - can be seen.
+enum class ScreenCoverage
+{
+    Partial,
+    Full
+};
 
 // Renders all screens in order from bottom to back,
 // only passes input to the back screen
@@ -31,6 +40,7 @@ public:
             glm::vec2{1},
             false
         },
+        mCoverage{},
         mLogger{Logging::LogState::GetLogger("Gui::ScreenStack")}
     {
         mLogger.Debug() << "Constructed @" << std::hex << this << std::dec << "\n";
@@ -46,18 +56,29 @@ public:
         return false;
     }
 
-    void PushScreen(Widget* widget)
+    void PushScreen(Widget* widget, ScreenCoverage coverage = ScreenCoverage::Partial)
     {
         mLogger.Debug() << "Widgets: " << GetChildren() << "\n";
         mLogger.Debug() << "Pushed widget " << std::hex << widget << std::dec << "\n";
         AddChildBack(widget);
+        mCoverage.emplace_back(coverage);
     }
 
     void PopScreen()
     {
         ASSERT(mChildren.size() > 0);
+        ASSERT(mCoverage.size() == mChildren.size());
         mLogger.Debug() << "Popped widget: "  << std::hex << mChildren.back() << std::dec << "\n";
         PopChild();
+        mCoverage.pop_back();
+    }
+
+    // True when some screen in the stack hides the whole window,
+    // so there is no point rendering the world behind the GUI
+    bool IsCovered() const
+    {
+        return std::find(mCoverage.begin(), mCoverage.end(), ScreenCoverage::Full)
+            != mCoverage.end();
     }
 
     Widget* Top() const
@@ -73,6 +94,8 @@ public:
 
 private:
 
+    // Coverage of each pushed screen, parallel to mChildren
+    std::vector<ScreenCoverage> mCoverage;
     const Logging::Logger& mLogger;
 };
 
@@ -92,11 +92,13 @@ public:
             && Within(GetValue(event)))
         {
             mHandlePressed = true;
+            SubscribeMouseMoves(true);
             return true;
         }
         else if (std::holds_alternative<LeftMouseRelease>(event))
         {
             mHandlePressed = false;
+            SubscribeMouseMoves(false);
         }
 
         if (mHandlePressed && std::holds_alternative<MouseMove>(event))
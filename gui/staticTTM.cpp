@@ -1,7 +1,5 @@
 #include "gui/staticTTM.hpp"
 
-#include "bak/textureFactory.hpp"
-
 #include "com/assert.hpp"
 #include "com/logger.hpp"
 
@@ -9,14 +7,17 @@
 
 #include "gui/colors.hpp"
 
+#include <functional>
+
 namespace Gui {
 
 StaticTTM::StaticTTM(
-    Graphics::SpriteManager& spriteManager,
+    SceneTextureCache& sceneTextures,
     const BAK::Scene& sceneInit,
     const BAK::Scene& sceneContent)
 :
-    mSpriteSheet{spriteManager.AddSpriteSheet()},
+    mTextures{},
+    mSpriteSheet{},
     mSceneFrame{
         Graphics::DrawMode::Rect,
         mSpriteSheet,
@@ -33,27 +34,34 @@ StaticTTM::StaticTTM(
     mLogger{Logging::LogState::GetLogger("Gui::StaticTTM")}
 {
     mLogger.Debug() << "Loading scene: " << sceneInit << " with " << sceneContent << "\n";
-    auto textures = Graphics::TextureStore{};
-    std::unordered_map<unsigned, unsigned> offsets{};
+    std::vector<SceneImage> images{};
+    std::vector<unsigned> imageSlots{};
 
-    // Load all the image slots
-    for (const auto& scene : {sceneInit, sceneContent})
+    // Gather all the image slots
+    for (const auto& scene : {std::cref(sceneInit), std::cref(sceneContent)})
     {
-        for (const auto& [imageKey, imagePal] : scene.mImages)
+        for (const auto& [imageKey, imagePal] : scene.get().mImages)
         {
             const auto& [image, palKey] = imagePal;
             mLogger.Debug() << "Loading image slot: " << imageKey 
                 << " (" << image << ")\n";
-            const auto& palette = scene.mPalettes.find(palKey)->second;
-            offsets[imageKey] = textures.GetTextures().size();
-
-            BAK::TextureFactory::AddToTextureStore(
-                textures,
-                image,
-                palette);
+            const auto& palette = scene.get().mPalettes.find(palKey)->second;
+            images.emplace_back(SceneImage{image, palette});
+            imageSlots.emplace_back(imageKey);
         }
     }
 
+    // Scenes with the same images share a sprite sheet
+    mTextures = sceneTextures.GetTextures(images);
+    mSpriteSheet = mTextures->GetSpriteSheet();
+    mSceneFrame.SetSpriteSheet(mSpriteSheet);
+    const auto& textures = mTextures->GetTextures();
+
+    // Later slots replace earlier ones with the same key
+    std::unordered_map<unsigned, unsigned> offsets{};
+    for (unsigned i = 0; i < imageSlots.size(); i++)
+        offsets[imageSlots[i]] = mTextures->GetOffset(i);
+
     // Make sure all the refs are constant
     mSceneElements.reserve(
         sceneInit.mActions.size()
@@ -151,10 +159,6 @@ StaticTTM::StaticTTM(
             );
         }
     }
-
-    spriteManager
-        .GetSpriteSheet(mSpriteSheet)
-        .LoadTexturesGL(textures);
 }
 
 Widget* StaticTTM::GetScene()
@@ -5,9 +5,9 @@
 #include "com/logger.hpp"
 
 #include "graphics/guiTypes.hpp"
-#include "graphics/sprites.hpp"
 
 #include "gui/scene.hpp"
+#include "gui/sceneTextureCache.hpp"
 #include "gui/core/widget.hpp"
 
 namespace Gui {
@@ -19,7 +19,7 @@ class StaticTTM
 {
 public:
     StaticTTM(
-        Graphics::SpriteManager& spriteManager,
+        SceneTextureCache& sceneTextures,
         const BAK::Scene& sceneInit,
         const BAK::Scene& sceneContent);
 
@@ -27,6 +27,7 @@ public:
     Widget* GetBackground();
 
 private:
+    std::shared_ptr<const SceneTextures> mTextures;
     Graphics::SpriteSheetIndex mSpriteSheet;
     Widget mSceneFrame;
     std::optional<Widget> mDialogBackground;
@@ -53,7 +53,7 @@ public:
     void EnterTemple(
         BAK::KeyTarget keyTarget,
         unsigned templeIndex,
-        BAK::ShopStats& shopStats)
+        const BAK::ShopStats& shopStats)
     {
         mShopStats = &shopStats;
         mTarget = keyTarget;
@@ -241,7 +241,7 @@ private:
     IGuiManager& mGuiManager;
 
     BAK::InventoryItem* mItem;
-    BAK::ShopStats* mShopStats;
+    const BAK::ShopStats* mShopStats;
     BAK::KeyTarget mTarget;
     unsigned mTempleNumber;
 
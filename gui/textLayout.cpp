@@ -0,0 +1,467 @@
+#include "gui/textLayout.hpp"
+
+#include "com/assert.hpp"
+
+#include "graphics/glm.hpp"
+
+#include "gui/colors.hpp"
+#include "gui/fontManager.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace Gui {
+
+TextLayout::Glyph::Glyph(
+    Graphics::SpriteSheetIndex spriteSheet,
+    Graphics::TextureIndex texture,
+    glm::vec4 color,
+    glm::vec2 pos,
+    glm::vec2 dims)
+:
+    mDrawInfo{
+        Graphics::DrawMode::Sprite,
+        spriteSheet,
+        texture,
+        Graphics::ColorMode::ReplaceColor,
+        color},
+    mPositionInfo{
+        pos,
+        dims,
+        true}
+{}
+
+const Graphics::DrawInfo& TextLayout::Glyph::GetDrawInfo() const
+{
+    return mDrawInfo;
+}
+
+const Graphics::PositionInfo& TextLayout::Glyph::GetPositionInfo() const
+{
+    return mPositionInfo;
+}
+
+void TextLayout::Glyph::AdjustPosition(glm::vec2 adj)
+{
+    mPositionInfo.mPosition += adj;
+}
+
+TextLayout::TextLayout(
+    const Font& fr,
+    std::string_view text,
+    glm::vec2 dims,
+    const TextLayoutParams& params)
+:
+    mGlyphs{},
+    mElements{},
+    mDimensions{},
+    mConsumed{0}
+{
+    const auto& logger = Logging::LogState::GetLogger("Gui::TextLayout");
+
+    mGlyphs.reserve(text.size() * 2);
+
+    const auto& font = fr.GetFont();
+    const auto newLineMultiplier = params.mNewLineMultiplier;
+    const auto isBold = params.mIsBold;
+    const auto initialPosition = glm::vec2{0};
+    auto charPos = initialPosition;
+    auto limit = initialPosition + dims;
+
+    struct Line
+    {
+        // Index of the first glyph of this line
+        std::size_t mFirst;
+        glm::vec2 mDimensions;
+    };
+
+    std::vector<Line> lines{};
+    lines.emplace_back(Line{0, glm::vec2{0}});
+
+    auto italic   = false;
+    auto emphasis = false;
+    auto bold     = false;
+    auto unbold   = false;
+    auto red      = false;
+    auto white    = false;
+    auto inWord   = false;
+    auto moredhel = false;
+
+    const auto NextLine = [&]{
+        // Save this line's dims and move on to the next
+        ASSERT(lines.size() > 0);
+        lines.back().mDimensions = glm::vec2{
+            charPos.x + font.GetSpace(),
+            charPos.y + font.GetHeight() * newLineMultiplier + 1
+        };
+        logger.Spam() << "NextLine: pos: " << charPos << " prevDims: " << lines.back().mDimensions << "\n";
+        lines.emplace_back(Line{mGlyphs.size(), glm::vec2{0}});
+
+        charPos.x = initialPosition.x;
+        charPos.y += font.GetHeight() * newLineMultiplier + 1;
+
+        italic = false;
+        unbold = false;
+        red = false;
+        white = false;
+        emphasis = false;
+        inWord = false;
+    };
+
+    const auto AdvanceChar = [&](auto w){
+        charPos.x += w;
+    };
+
+    const auto Advance = [&](auto w){
+        AdvanceChar(w);
+        if (charPos.x > limit.x)
+            NextLine();
+    };
+
+    unsigned wordLetters = 0;
+
+    const auto Draw = [&](const auto& pos, auto c, const auto& color)
+    {
+        mGlyphs.emplace_back(
+            fr.GetSpriteSheet(),
+            static_cast<Graphics::TextureIndex>(
+                font.GetIndex(c)),
+            color,
+            pos,
+            glm::vec2{font.GetWidth(c), font.GetHeight()});
+    };
+
+    const auto DrawNormal = [&](const auto& pos, auto c)
+    {
+        Draw(
+            charPos,
+            c,
+            Color::black);
+    };
+
+    const auto DrawBold = [&](const auto& pos, auto c, auto bg, auto fg)
+    {
+        Draw(
+            charPos + glm::vec2{0, 1},
+            c,
+            bg);
+
+        Draw(
+            charPos,
+            c,
+            fg);
+    };
+
+    const auto DrawMoredhel = [&](const auto& pos, auto c)
+    {
+        Draw(
+            charPos + glm::vec2{0, -1},
+            c,
+            Color::moredhelFontUpper);
+
+        Draw(
+            charPos + glm::vec2{0, 1},
+            c,
+            Color::moredhelFontLower);
+
+        Draw(
+            charPos,
+            c,
+            Color::black);
+    };
+
+    unsigned currentChar = 0;
+    for (; currentChar < text.size(); currentChar++)
+    {
+        const auto c = text[currentChar];
+        logger.Spam() << "Char[" << c << "]" << std::hex
+            << +c << std::dec << " " << charPos << "\n";
+
+        if (c == '\n')
+        {
+            NextLine();
+        }
+        else if (c == '\t')
+        {
+            Advance(font.GetSpace() * 4);
+            bold = false;
+        }
+        else if (c == ' ')
+        {
+            if (moredhel)
+            {
+                // moredhel text is very spaced...
+                Advance(font.GetSpace() * 6);
+            }
+            Advance(font.GetSpace());
+            emphasis = false;
+            italic = false;
+        }
+        else if (c == '#')
+        {
+            bold = !bold;
+        }
+        else if (c == static_cast<char>(0xf4))
+        {
+            unbold = !unbold;
+        }
+        else if (c == static_cast<char>(0xf5))
+        {
+            red = !red;
+        }
+        else if (c == static_cast<char>(0xf6))
+        {
+            white = !white;
+        }
+        else if (c == static_cast<char>(0xf7))
+        {
+            moredhel = !moredhel;
+        }
+        else if (c == static_cast<char>(0xf0))
+        {
+            emphasis = true;
+        }
+        else if (c == static_cast<char>(0xf1))
+        {
+            emphasis = true;
+        }
+        else if (c == static_cast<char>(0xf3))
+        {
+            italic = true;
+        }
+        else if (c == static_cast<char>(0xe1)
+            || c == static_cast<char>(0xe2) // not sure on e2
+            || c == static_cast<char>(0xe3)) // not sure on e3
+        {
+            // Book text.. quoted or something
+            DrawNormal(charPos, ' ');
+            Advance(font.GetSpace() / 2.0);
+        }
+        else
+        {
+            if (moredhel)
+            {
+                DrawMoredhel(charPos, c);
+            }
+            else if (bold)
+            {
+                if (isBold)
+                    DrawNormal(charPos, c);
+                else
+                    DrawBold(charPos, c, Color::buttonShadow, Color::fontHighlight);
+            }
+            else if (unbold)
+            {
+                // Maybe "lowlight", inactive
+                DrawBold(charPos, c, Color::black, Color::fontUnbold);
+            }
+            else if (red)
+            {
+                DrawBold(charPos, c, Color::fontRedLowlight, Color::fontRedHighlight);
+            }
+            else if (white)
+            {
+                DrawBold(charPos, c, Color::black, Color::fontWhiteHighlight);
+            }
+            else if (emphasis)
+            {
+                Draw(
+                    charPos,
+                    c,
+                    Color::fontEmphasis);
+            }
+            else if (italic)
+            {
+                Draw(
+                    charPos,
+                    c,
+                    Color::fontLowlight);
+                // Draw italic...
+            }
+            else
+            {
+                if (isBold)
+                    DrawBold(charPos, c, Color::buttonShadow, Color::fontHighlight);
+                else
+                    DrawNormal(charPos, c);
+            }
+
+            Advance(font.GetWidth(c));
+        }
+
+        const auto nextChar = currentChar + 1;
+        if (nextChar < text.size())
+        {
+            const auto ch = text[nextChar];
+            const auto isAlphaNum = ch >= '!' || c <= 'z';
+
+            if (isAlphaNum && !inWord)
+            {
+                const auto saved = charPos;
+                const auto wordStart = std::next(text.begin(), nextChar);
+                const auto it = std::find_if(
+                    wordStart,
+                    std::next(text.begin(), text.size()),
+                    [](const auto& c){ return c < '!' || c > 'z'; });
+
+                // Check if this word would overflow our bounds
+                wordLetters = std::distance(wordStart, it);
+                for (const auto& ch : text.substr(nextChar, wordLetters))
+                    AdvanceChar(font.GetWidth(ch));
+                logger.Spam() << "Next Word: " << text.substr(nextChar, wordLetters) << "\n";
+
+                if (charPos.x >= limit.x)
+                {
+                    charPos = saved;
+                    NextLine();
+                }
+                else
+                    charPos = saved;
+            }
+            else if (isAlphaNum)
+            {
+                inWord = true;
+            }
+            else
+            {
+                // Exiting a word
+                emphasis = false;
+                italic = false;
+                inWord = false;
+            }
+        }
+
+        if (charPos.y + font.GetHeight() > limit.y)
+            break;
+    }
+
+    // Set the dims of the final line
+    logger.Spam() << "LastLine\n"; NextLine();
+
+    if (params.mCenterVertical)
+    {
+        const auto verticalAdjustment = limit.y > charPos.y
+            ? (limit.y - charPos.y ) / 2.0
+            : 0;
+
+        for (auto& glyph : mGlyphs)
+            glyph.AdjustPosition(
+                glm::vec2{0, verticalAdjustment});
+        charPos.y += verticalAdjustment;
+    }
+
+    if (params.mCenterHorizontal)
+    {
+        for (unsigned i = 0; i < lines.size(); i++)
+        {
+            const auto& line = lines[i];
+            const auto lineEnd = i + 1 < lines.size()
+                ? lines[i + 1].mFirst
+                : mGlyphs.size();
+            const auto lineWidth = line.mDimensions.x;
+            auto horizontalAdjustment = (limit.x - lineWidth) / 2.0;
+            if (horizontalAdjustment < 0) horizontalAdjustment = 0;
+            logger.Spam() << "Line: " << lineWidth << " lim: " << limit.x << " adj: " << horizontalAdjustment << "\n";
+            for (auto g = line.mFirst; g < lineEnd; g++)
+            {
+                mGlyphs[g].AdjustPosition(
+                    glm::vec2{horizontalAdjustment, 0});
+            }
+        }
+    }
+
+    const auto maxX = std::max_element(
+        lines.begin(), lines.end(),
+        [](const auto& lhs, const auto& rhs){
+            return lhs.mDimensions.x < rhs.mDimensions.x;
+        });
+
+    ASSERT(currentChar <= text.size() * 2);
+
+    mDimensions = glm::vec2{maxX->mDimensions.x, charPos.y};
+    mConsumed = currentChar;
+
+    // mGlyphs no longer changes size so these stay valid
+    mElements.reserve(mGlyphs.size());
+    for (auto& glyph : mGlyphs)
+        mElements.emplace_back(&glyph);
+}
+
+TextLayoutCache& TextLayoutCache::Get()
+{
+    static TextLayoutCache cache{};
+    return cache;
+}
+
+TextLayoutCache::TextLayoutCache()
+:
+    mEntries{},
+    mLookup{},
+    mHits{0},
+    mMisses{0},
+    mLogger{Logging::LogState::GetLogger("Gui::TextLayoutCache")}
+{
+    mLookup.reserve(sCapacity);
+}
+
+std::shared_ptr<const TextLayout> TextLayoutCache::GetLayout(
+    const Font& font,
+    std::string_view text,
+    glm::vec2 dims,
+    const TextLayoutParams& params)
+{
+    const auto key = KeyView{&font, text, dims, params};
+    if (auto it = mLookup.find(key); it != mLookup.end())
+    {
+        mHits++;
+        // Move to the front, this is now the most recently used
+        mEntries.splice(mEntries.begin(), mEntries, it->second);
+        return it->second->second;
+    }
+
+    mMisses++;
+    auto layout = std::make_shared<const TextLayout>(
+        font, text, dims, params);
+
+    if (mEntries.size() == sCapacity)
+    {
+        mLookup.erase(mEntries.back().first);
+        mEntries.pop_back();
+    }
+
+    mEntries.emplace_front(
+        Key{&font, std::string{text}, dims, params},
+        layout);
+    mLookup.emplace(mEntries.front().first, mEntries.begin());
+
+    return layout;
+}
+
+void TextLayoutCache::Clear()
+{
+    mLogger.Debug() << "Clearing " << mEntries.size() << " layouts, hits: "
+        << mHits << " misses: " << mMisses << "\n";
+    mLookup.clear();
+    mEntries.clear();
+}
+
+std::size_t TextLayoutCache::KeyHash::operator()(const KeyView& key) const
+{
+    const auto Combine = [](std::size_t seed, std::size_t value)
+    {
+        return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+
+    auto seed = std::hash<std::string_view>{}(key.mText);
+    seed = Combine(seed, std::hash<const Font*>{}(key.mFont));
+    seed = Combine(seed, std::hash<float>{}(key.mDims.x));
+    seed = Combine(seed, std::hash<float>{}(key.mDims.y));
+    seed = Combine(seed, std::hash<double>{}(key.mParams.mNewLineMultiplier));
+    seed = Combine(seed,
+        (key.mParams.mCenterHorizontal << 0)
+        | (key.mParams.mCenterVertical << 1)
+        | (key.mParams.mIsBold << 2));
+    return seed;
+}
+
+}
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "com/logger.hpp"
+
+#include "graphics/IGuiElement.hpp"
+#include "graphics/guiTypes.hpp"
+
+#include <glm/glm.hpp>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Gui {
+
+class Font;
+
+struct TextLayoutParams
+{
+    bool mCenterHorizontal;
+    bool mCenterVertical;
+    bool mIsBold;
+    double mNewLineMultiplier;
+
+    bool operator==(const TextLayoutParams&) const = default;
+};
+
+// The result of laying out a string in a box: where every glyph
+// goes, the dimensions of the laid out text and how much of the
+// text fit. Layouts are immutable once built so any number of
+// TextBoxes can display the same one.
+class TextLayout
+{
+public:
+    // A single drawn character, positioned relative to the box
+    class Glyph : public Graphics::IGuiElement
+    {
+    public:
+        Glyph(
+            Graphics::SpriteSheetIndex spriteSheet,
+            Graphics::TextureIndex texture,
+            glm::vec4 color,
+            glm::vec2 pos,
+            glm::vec2 dims);
+
+        const Graphics::DrawInfo& GetDrawInfo() const override;
+        const Graphics::PositionInfo& GetPositionInfo() const override;
+
+        void AdjustPosition(glm::vec2 adj);
+
+    private:
+        Graphics::DrawInfo mDrawInfo;
+        Graphics::PositionInfo mPositionInfo;
+    };
+
+    TextLayout(
+        const Font& font,
+        std::string_view text,
+        glm::vec2 dims,
+        const TextLayoutParams& params);
+
+    TextLayout(const TextLayout&) = delete;
+    TextLayout& operator=(const TextLayout&) = delete;
+
+    // Pointers into this layout's glyphs in draw order
+    const std::vector<Graphics::IGuiElement*>& GetElements() const { return mElements; }
+    std::size_t GetNumberGlyphs() const { return mGlyphs.size(); }
+    glm::vec2 GetDimensions() const { return mDimensions; }
+    // Number of characters of the text that were consumed
+    std::size_t GetConsumed() const { return mConsumed; }
+
+private:
+    std::vector<Glyph> mGlyphs;
+    std::vector<Graphics::IGuiElement*> mElements;
+    glm::vec2 mDimensions;
+    std::size_t mConsumed;
+};
+
+// Least recently used cache of layouts keyed on everything that
+// affects them, so showing the same label or dialog page again
+// doesn't lay it out again.
+class TextLayoutCache
+{
+public:
+    static constexpr std::size_t sCapacity = 256;
+
+    static TextLayoutCache& Get();
+
+    std::shared_ptr<const TextLayout> GetLayout(
+        const Font& font,
+        std::string_view text,
+        glm::vec2 dims,
+        const TextLayoutParams& params);
+
+    void Clear();
+
+    std::size_t size() const { return mEntries.size(); }
+    std::size_t GetHits() const { return mHits; }
+    std::size_t GetMisses() const { return mMisses; }
+
+private:
+    TextLayoutCache();
+
+    // Lookups use a view of the text so that a hit allocates nothing,
+    // the text is only copied into a Key when a layout is inserted
+    struct KeyView
+    {
+        const Font* mFont;
+        std::string_view mText;
+        glm::vec2 mDims;
+        TextLayoutParams mParams;
+
+        bool operator==(const KeyView&) const = default;
+    };
+
+    struct Key
+    {
+        const Font* mFont;
+        std::string mText;
+        glm::vec2 mDims;
+        TextLayoutParams mParams;
+
+        KeyView GetView() const { return KeyView{mFont, mText, mDims, mParams}; }
+    };
+
+    struct KeyHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(const KeyView&) const;
+        std::size_t operator()(const Key& key) const { return (*this)(key.GetView()); }
+    };
+
+    struct KeyEqual
+    {
+        using is_transparent = void;
+        bool operator()(const Key& lhs, const Key& rhs) const { return lhs.GetView() == rhs.GetView(); }
+        bool operator()(const KeyView& lhs, const Key& rhs) const { return lhs == rhs.GetView(); }
+        bool operator()(const Key& lhs, const KeyView& rhs) const { return lhs.GetView() == rhs; }
+    };
+
+    using Entry = std::pair<Key, std::shared_ptr<const TextLayout>>;
+
+    std::list<Entry> mEntries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash, KeyEqual> mLookup;
+    std::size_t mHits;
+    std::size_t mMisses;
+
+    const Logging::Logger& mLogger;
+};
+
+}